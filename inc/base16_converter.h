@@ -28,9 +28,55 @@
 extern "C" {
 #endif
 
+#include "baseX_ignore.h"
+#include "baseX_layout.h"
 #include "baseX_types.h"
+#include <stddef.h>
 #include <stdint.h>
 
+/// Number of characters of n encoded bytes, without NULL-terminator.
+/// Does not check for overflow, use base16_encodedLength() at runtime.
+#define BASE16_ENCODED_LENGTH(n) ((n) * 2)
+/// Number of bytes decoded from n characters
+#define BASE16_MAX_DECODED_LENGTH(n) ((n) / 2)
+
+/**
+ * @brief Resolved base16 output alphabet.
+ *
+ * Holds both characters of every byte value, so the encoder writes each pair
+ * with a single 16 bit store. Use the prebuilt base16_upperAlphabet and
+ * base16_lowerAlphabet or resolve a custom alphabet once with
+ * base16_alphabetInit().
+ */
+typedef struct {
+  char pairs[256][2]; ///< Characters of every byte, high nibble first
+  char digits[16];    ///< Characters of the 16 nibble values
+} base16_alphabet;
+
+extern const base16_alphabet base16_upperAlphabet; ///< 0-9 and A-F (RFC 4648)
+extern const base16_alphabet base16_lowerAlphabet; ///< 0-9 and a-f
+
+/**
+ * @brief State of an incremental base16 encoder.
+ *
+ * Every byte is encoded on its own, so there is no incomplete group to carry.
+ * The context exists for the same interface as the other bases.
+ */
+typedef struct {
+  uint8_t reserved; ///< Unused
+} base16_encodeContext;
+
+/**
+ * @brief State of an incremental base16 decoder.
+ *
+ * Carries the high nibble of a byte split between two chunks.
+ */
+typedef struct {
+  uint8_t high;    ///< Pending high nibble
+  uint8_t pending; ///< A high nibble is pending
+  uint8_t started; ///< At least one character received
+} base16_decodeContext;
+
 /**
  * @brief Decodes a base16-encoded string into a byte array.
  *
@@ -42,14 +88,116 @@ extern "C" {
  * bytes.
  * @param[in] decodedBytesSize Size of the output buffer in bytes.
  * @param[in] srcString NULL-terminated base16-encoded input string.
- * @param[in] srcLength the size of srcString
  * @return baseX_returnType Status code.
  */
 baseX_returnType base16_decodeString(uint8_t *decodedBytes,
-                                     uint32_t *decodedLength,
-                                     uint32_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
                                      const char *srcString);
 
+/**
+ * @brief Decodes a base16-encoded character sequence of known length.
+ *
+ * Same as base16_decodeString(), but the input is given by pointer and
+ * length and does not need to be NULL-terminated.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base16-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength);
+
+/**
+ * @brief Decodes base16 characters over the input buffer.
+ *
+ * Same as base16_decodeN(), but the decoded bytes are written to the start
+ * of the buffer holding the characters. The decoder never writes ahead of the
+ * character it reads, so no second buffer is needed. On an error the content
+ * of the buffer is undefined.
+ *
+ * @param[in,out] buffer base16-encoded characters, decoded bytes on return.
+ * @param[in] length Number of characters in buffer.
+ * @param[out] decodedLength Pointer to store the number of decoded bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength);
+
+/**
+ * @brief Decodes base16 characters and skips the ignorable characters.
+ *
+ * Decodes spaced or wrapped input like "DE AD BE EF" without copying it
+ * first, an ignorable character may also split a pair. Input without
+ * ignorable characters is detected with a vectorized scan and decoded by
+ * base16_decodeN() directly, otherwise the runs between the ignorable
+ * characters are passed to the incremental decoder.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base16-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] ignore Characters to skip, e.g. &baseX_whitespace.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeIgnore(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     size_t srcLength,
+                                     const baseX_ignoreSet *ignore);
+
+/**
+ * @brief Checks base16 characters without decoding them.
+ *
+ * Accepts exactly the input base16_decodeN() accepts: a non-zero, even number
+ * of hexadecimal characters in any case. On x86 CPUs with SSE4.1 or AVX2 the
+ * characters are checked in blocks of 16 or 32, nothing is written except the
+ * error offset.
+ *
+ * @param[in] srcString base16-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[out] errorOffset Set on BASEX_SRCERROR to the position of the first
+ * invalid character, or to srcLength if the length is wrong. May be NULL.
+ * @return baseX_returnType BASEX_OK, BASEX_SRCERROR or BASEX_ARGUMENTS.
+ */
+baseX_returnType base16_validate(const char *srcString,
+                                 size_t srcLength,
+                                 size_t *errorOffset);
+
+/**
+ * @brief Decodes base16 characters in constant time.
+ *
+ * Accepts the same input as base16_decodeN(). Every character is converted
+ * with arithmetic range masks instead of branches or table lookups, so the
+ * timing depends on the input length only and not on the characters. Use it
+ * for secrets like keys. The output buffer is written even if the input is
+ * invalid.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base16-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeConstantTime(uint8_t *decodedBytes,
+                                           size_t *decodedLength,
+                                           size_t decodedBytesSize,
+                                           const char *srcString,
+                                           size_t srcLength);
+
 /**
  * @brief Encodes a byte array into a base16-encoded string (RFC 4648).
  *
@@ -64,9 +212,260 @@ baseX_returnType base16_decodeString(uint8_t *decodedBytes,
  * @return baseX_returnType Status code.
  */
 baseX_returnType base16_encodeBytes(char *encodedString,
-                                    uint32_t encodedSize,
+                                    size_t encodedSize,
                                     const uint8_t *srcBytes,
-                                    uint32_t srcLength);
+                                    size_t srcLength);
+
+/**
+ * @brief Encodes a byte array with the given alphabet.
+ *
+ * Same as base16_encodeBytes(), but the characters are taken from the
+ * alphabet, e.g. base16_lowerAlphabet for lowercase hex.
+ *
+ * @param[out] encodedString Buffer to store the base16-encoded string.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[in] srcBytes Pointer to the input byte array.
+ * @param[in] srcLength Length of the input byte array in bytes.
+ * @param[in] alphabet Output alphabet.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeBytesAlphabet(char *encodedString,
+                                            size_t encodedSize,
+                                            const uint8_t *srcBytes,
+                                            size_t srcLength,
+                                            const base16_alphabet *alphabet);
+
+/**
+ * @brief Resolves a custom alphabet into its lookup table.
+ *
+ * @param[out] alphabet Alphabet to initialize.
+ * @param[in] digits The 16 distinct characters of the values 0 to 15, does
+ * not need to be NULL-terminated.
+ * @return baseX_returnType BASEX_ARGUMENTS if a character is repeated, is
+ * '\0' or NULL.
+ */
+baseX_returnType base16_alphabetInit(base16_alphabet *alphabet,
+                                     const char *digits);
+
+/**
+ * @brief Encodes a byte array into wrapped or grouped characters.
+ *
+ * Same as base16_encodeBytesAlphabet(), but the separators of the layout are
+ * inserted while encoding, e.g. "DE:AD:BE:EF" with groups of 2 and ":". The
+ * output is NULL-terminated and needs base16_encodedLengthLayout() + 1
+ * characters.
+ *
+ * @param[out] encodedString Buffer to store the laid out characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[in] srcBytes Pointer to the input byte array.
+ * @param[in] srcLength Length of the input byte array in bytes.
+ * @param[in] alphabet Alphabet of the output, e.g. &base16_upperAlphabet.
+ * @param[in] layout Line length, group length and their separators.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeBytesLayout(char *encodedString,
+                                          size_t encodedSize,
+                                          const uint8_t *srcBytes,
+                                          size_t srcLength,
+                                          const base16_alphabet *alphabet,
+                                          const baseX_layout *layout);
+
+/**
+ * @brief Returns the number of characters base16_encodeBytesLayout() writes
+ * for srcLength bytes, without NULL-terminator.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @param[in] layout The layout of the output.
+ * @return size_t Number of characters including the separators, SIZE_MAX if
+ * not representable or if the layout is invalid.
+ */
+size_t base16_encodedLengthLayout(size_t srcLength,
+                                  const baseX_layout *layout);
+
+/**
+ * @brief Returns the number of characters base16_encodeBytes() writes
+ * for srcLength bytes.
+ *
+ * The NULL-terminator is not included, the output buffer must be one
+ * character larger.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @return size_t Number of characters, SIZE_MAX if not representable.
+ */
+size_t base16_encodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the maximum number of bytes decoded from srcLength
+ * characters.
+ *
+ * Base16 has no padding, so this is the exact length of a valid input.
+ *
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Maximum number of decoded bytes.
+ */
+size_t base16_maxDecodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the number of bytes base16_decodeN() writes for the
+ * given input.
+ *
+ * The input is not inspected, the length is the same as
+ * base16_maxDecodedLength() and is provided for the same interface as the
+ * other bases.
+ *
+ * @param[in] srcString Encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return size_t Number of decoded bytes of a valid input.
+ */
+size_t base16_decodedLength(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Initializes an incremental base16 encoder.
+ *
+ * Encoding the input in arbitrary chunks with base16_encodeUpdate() and
+ * finishing with base16_encodeFinal() produces the same characters as
+ * base16_encodeBytes() on the whole input. The output is not NULL-terminated.
+ *
+ * @param[out] ctx Encoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeInit(base16_encodeContext *ctx);
+
+/**
+ * @brief Encodes the next chunk of bytes.
+ *
+ * The output buffer must hold 2 characters per input byte, otherwise nothing
+ * is consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base16 characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written.
+ * @param[in] srcBytes Pointer to the next input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeUpdate(base16_encodeContext *ctx,
+                                     char *encodedString,
+                                     size_t encodedSize,
+                                     size_t *encodedLength,
+                                     const uint8_t *srcBytes,
+                                     size_t srcLength);
+
+/**
+ * @brief Finishes the incremental base16 encoder.
+ *
+ * Never writes any characters, provided for the same interface as the other
+ * bases.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base16 characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written, always 0.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeFinal(base16_encodeContext *ctx,
+                                    char *encodedString,
+                                    size_t encodedSize,
+                                    size_t *encodedLength);
+
+/**
+ * @brief Initializes an incremental base16 decoder.
+ *
+ * Decoding the characters in arbitrary chunks with base16_decodeUpdate() and
+ * finishing with base16_decodeFinal() produces the same bytes as
+ * base16_decodeString() on the whole input.
+ *
+ * @param[out] ctx Decoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeInit(base16_decodeContext *ctx);
+
+/**
+ * @brief Decodes the next chunk of base16 characters.
+ *
+ * The output buffer must hold (pending characters + srcLength) / 2 bytes,
+ * otherwise nothing is consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written.
+ * @param[in] srcString Next base16 characters, not NULL-terminated.
+ * @param[in] srcLength Number of characters.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeUpdate(base16_decodeContext *ctx,
+                                     uint8_t *decodedBytes,
+                                     size_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     const char *srcString,
+                                     size_t srcLength);
+
+/**
+ * @brief Finishes the incremental base16 decoder.
+ *
+ * Fails with BASEX_SRCERROR if no or an odd number of characters were
+ * received. Never writes any bytes.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written, always 0.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeFinal(base16_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength);
+
+/**
+ * @brief Encodes many inputs into one contiguous output arena.
+ *
+ * The arguments and the output size are checked once for the whole batch.
+ * The output of item i is written to arena[offsets[i]] up to
+ * arena[offsets[i + 1]] and is not NULL-terminated.
+ * Short items are gathered and converted together by the vectorized
+ * kernels.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] arenaSize Size of the output buffer.
+ * @param[out] offsets Start of every output, count + 1 entries. The last
+ * entry is the total output length.
+ * @param[in] items Inputs to encode.
+ * @param[in] count Number of items.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_encodeBatch(char *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count);
+
+/**
+ * @brief Decodes many inputs into one contiguous output arena.
+ *
+ * Every item is decoded like base16_decodeN(). The output of item i is
+ * written to arena[offsets[i]] up to arena[offsets[i + 1]].
+ * Short items are gathered and converted together by the vectorized
+ * kernels.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] arenaSize Size of the output buffer.
+ * @param[out] offsets Start of every output, count + 1 entries. The last
+ * entry is the total output length.
+ * @param[in] items Inputs to decode.
+ * @param[in] count Number of items.
+ * @param[out] errorItem Index of the item which failed to decode, may be
+ * NULL.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base16_decodeBatch(uint8_t *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count,
+                                    size_t *errorItem);
 
 #ifdef __cplusplus
 }
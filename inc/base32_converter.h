@@ -28,10 +28,67 @@
 extern "C" {
 #endif
 
+#include "baseX_ignore.h"
+#include "baseX_layout.h"
 #include "baseX_types.h"
+#include <stddef.h>
 #include <stdint.h>
 
-#define BASE32_BIT_LENGTH (5) ///< Bit length of base32 input
+#define BASE32_BIT_LENGTH (5)  ///< Bit length of base32 input
+#define BASE32_GROUP_BYTES (5) ///< Number of bytes in a full base32 group
+#define BASE32_GROUP_CHARS (8) ///< Number of characters in a full group
+
+/// Number of characters of n encoded bytes, without NULL-terminator.
+/// Does not check for overflow, use base32_encodedLength() at runtime.
+#define BASE32_ENCODED_LENGTH(n)                                               \
+  (((n) + BASE32_GROUP_BYTES - 1) / BASE32_GROUP_BYTES * BASE32_GROUP_CHARS)
+/// Maximum number of bytes decoded from n characters
+#define BASE32_MAX_DECODED_LENGTH(n)                                           \
+  ((n) / BASE32_GROUP_CHARS * BASE32_GROUP_BYTES +                             \
+   (n) % BASE32_GROUP_CHARS * BASE32_BIT_LENGTH / 8)
+
+#define BASE32_INVALID (0x80) ///< Reverse table value of invalid characters
+
+/**
+ * @brief Base32 alphabet with its reverse table and padding policy.
+ *
+ * The same en- and decoder serve every alphabet. Use one of the prebuilt
+ * alphabets or resolve a custom one once with base32_alphabetInit().
+ */
+typedef struct {
+  char characters[33];  ///< Characters of the 32 values, NULL-terminated
+  char padding;         ///< Padding character, '\0' for unpadded output
+  uint8_t reverse[256]; ///< Value of every character or BASE32_INVALID
+} base32_alphabet;
+
+extern const base32_alphabet base32_rfcAlphabet; ///< RFC 4648 §6, padded
+extern const base32_alphabet base32_hexAlphabet; ///< RFC 4648 §7, padded
+/// Crockford, unpadded, decodes O as 0 and I and L as 1
+extern const base32_alphabet base32_crockfordAlphabet;
+extern const base32_alphabet base32_zAlphabet; ///< z-base-32, unpadded
+
+/**
+ * @brief State of an incremental base32 encoder.
+ *
+ * Carries the incomplete 5 byte group between two chunks.
+ */
+typedef struct {
+  uint8_t group[BASE32_GROUP_BYTES]; ///< Bytes of the incomplete group
+  uint8_t groupLength;               ///< Number of bytes in group
+} base32_encodeContext;
+
+/**
+ * @brief State of an incremental base32 decoder.
+ *
+ * Carries the incomplete 8 character group and the padding state.
+ */
+typedef struct {
+  uint8_t group[BASE32_GROUP_CHARS]; ///< 5 bit values of the incomplete group
+  uint8_t groupLength;               ///< Number of values in group
+  uint8_t paddingLength;             ///< Number of received padding characters
+  uint8_t maxPadding;                ///< Allowed number of padding characters
+  uint8_t started;                   ///< At least one character received
+} base32_decodeContext;
 
 /**
  * @brief Decodes a base32-encoded string into a byte array.
@@ -44,14 +101,158 @@ extern "C" {
  * bytes.
  * @param[in] decodedBytesSize Size of the output buffer in bytes.
  * @param[in] srcString NULL-terminated base32-encoded input string.
- * @param[in] srcLength the size of srcString
  * @return baseX_returnType Status code.
  */
 baseX_returnType base32_decodeString(uint8_t *decodedBytes,
-                                     uint32_t *decodedLength,
-                                     uint32_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
                                      const char *srcString);
 
+/**
+ * @brief Decodes a base32-encoded character sequence of known length.
+ *
+ * Same as base32_decodeString(), but the input is given by pointer and
+ * length and does not need to be NULL-terminated.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength);
+
+/**
+ * @brief Decodes base32 characters over the input buffer.
+ *
+ * Same as base32_decodeN(), but the decoded bytes are written to the start
+ * of the buffer holding the characters. The decoder never writes ahead of the
+ * character it reads, so no second buffer is needed. On an error the content
+ * of the buffer is undefined.
+ *
+ * @param[in,out] buffer base32-encoded characters, decoded bytes on return.
+ * @param[in] length Number of characters in buffer.
+ * @param[out] decodedLength Pointer to store the number of decoded bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength);
+
+/**
+ * @brief Decodes base32 characters and skips the ignorable characters.
+ *
+ * Decodes wrapped input without copying it first, a line may end inside a
+ * group. Input without ignorable characters is detected with a vectorized
+ * scan and decoded by base32_decodeN() directly, otherwise the runs between
+ * the ignorable characters are passed to the incremental decoder, which
+ * accepts the same input as base32_decodeString().
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] ignore Characters to skip, e.g. &baseX_whitespace.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeIgnore(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     size_t srcLength,
+                                     const baseX_ignoreSet *ignore);
+
+/**
+ * @brief Checks base32 characters without decoding them.
+ *
+ * Same as base32_validateAlphabet() with base32_rfcAlphabet. On x86 CPUs with
+ * SSE4.1 or AVX2 the characters before the padding are checked in blocks of
+ * 16 or 32.
+ *
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[out] errorOffset Set on BASEX_SRCERROR to the position of the first
+ * offending character, or to srcLength for an empty input. May be NULL.
+ * @return baseX_returnType BASEX_OK, BASEX_SRCERROR or BASEX_ARGUMENTS.
+ */
+baseX_returnType base32_validate(const char *srcString,
+                                 size_t srcLength,
+                                 size_t *errorOffset);
+
+/**
+ * @brief Checks base32 characters of an alphabet without decoding them.
+ *
+ * Accepts exactly the input base32_decodeNAlphabet() accepts with a large
+ * enough buffer: alphabet characters, optionally followed by at most as many
+ * padding characters as the last group needs. The padding is not required
+ * and ends the input.
+ *
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[out] errorOffset Set on BASEX_SRCERROR to the position of the first
+ * offending character, or to srcLength for an empty input. May be NULL.
+ * @param[in] alphabet Alphabet of the input.
+ * @return baseX_returnType BASEX_OK, BASEX_SRCERROR or BASEX_ARGUMENTS.
+ */
+baseX_returnType base32_validateAlphabet(const char *srcString,
+                                         size_t srcLength,
+                                         size_t *errorOffset,
+                                         const base32_alphabet *alphabet);
+
+/**
+ * @brief Decodes base32 characters of the given alphabet.
+ *
+ * Same as base32_decodeN(), which uses base32_rfcAlphabet. The padding is
+ * optional, an unpadded alphabet accepts no padding at all.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] alphabet Alphabet of the input.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeNAlphabet(uint8_t *decodedBytes,
+                                        size_t *decodedLength,
+                                        size_t decodedBytesSize,
+                                        const char *srcString,
+                                        size_t srcLength,
+                                        const base32_alphabet *alphabet);
+
+/**
+ * @brief Decodes base32 characters in constant time.
+ *
+ * Every character is converted with arithmetic range masks instead of
+ * branches or table lookups, so the timing depends on the input length only
+ * and not on the characters. Use it for secrets like TOTP seeds. Accepts
+ * RFC 4648 input with or without complete padding, in upper- or lowercase.
+ * Unlike base32_decodeN(), a last group of 1, 3 or 6 characters is
+ * rejected. The output buffer is written even if the input is invalid.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base32-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeConstantTime(uint8_t *decodedBytes,
+                                           size_t *decodedLength,
+                                           size_t decodedBytesSize,
+                                           const char *srcString,
+                                           size_t srcLength);
+
 /**
  * @brief Encodes a byte array into a base32-encoded string (RFC 4648).
  *
@@ -66,9 +267,279 @@ baseX_returnType base32_decodeString(uint8_t *decodedBytes,
  * @return baseX_returnType Status code.
  */
 baseX_returnType base32_encodeBytes(char *encodedString,
-                                    uint32_t encodedSize,
+                                    size_t encodedSize,
                                     const uint8_t *srcBytes,
-                                    uint32_t srcLength);
+                                    size_t srcLength);
+
+/**
+ * @brief Encodes a byte array with the given alphabet.
+ *
+ * Same as base32_encodeBytes(), which uses base32_rfcAlphabet. The output of
+ * an unpadded alphabet ends after the last character with data, it needs
+ * base32_encodedLengthAlphabet() + 1 characters.
+ *
+ * @param[out] encodedString Buffer to store the base32-encoded string.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[in] srcBytes Pointer to the input byte array.
+ * @param[in] srcLength Length of the input byte array in bytes.
+ * @param[in] alphabet Alphabet of the output.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeBytesAlphabet(char *encodedString,
+                                            size_t encodedSize,
+                                            const uint8_t *srcBytes,
+                                            size_t srcLength,
+                                            const base32_alphabet *alphabet);
+
+/**
+ * @brief Returns the number of characters base32_encodeBytesAlphabet()
+ * writes for srcLength bytes, without NULL-terminator.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @param[in] alphabet Alphabet of the output.
+ * @return size_t Number of characters, SIZE_MAX if not representable.
+ */
+size_t base32_encodedLengthAlphabet(size_t srcLength,
+                                    const base32_alphabet *alphabet);
+
+/**
+ * @brief Resolves a custom alphabet into its reverse table.
+ *
+ * Lowercase letters decode like uppercase ones and vice versa, as long as
+ * they are neither part of the alphabet nor the padding character.
+ *
+ * @param[out] alphabet Alphabet to initialize.
+ * @param[in] characters The 32 distinct characters of the values 0 to 31,
+ * does not need to be NULL-terminated.
+ * @param[in] padding Padding character, '\0' for unpadded output.
+ * @return baseX_returnType BASEX_ARGUMENTS if a character is repeated, is the
+ * padding character or NULL.
+ */
+baseX_returnType base32_alphabetInit(base32_alphabet *alphabet,
+                                     const char *characters,
+                                     char padding);
+
+/**
+ * @brief Encodes a byte array into wrapped or grouped characters.
+ *
+ * Same as base32_encodeBytesAlphabet(), but the separators of the layout are
+ * inserted while encoding, e.g. lines of 64 characters separated by
+ * "\\r\\n". The output is NULL-terminated and needs
+ * base32_encodedLengthLayout() + 1 characters.
+ *
+ * @param[out] encodedString Buffer to store the laid out characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[in] srcBytes Pointer to the input byte array.
+ * @param[in] srcLength Length of the input byte array in bytes.
+ * @param[in] alphabet Alphabet of the output, e.g. &base32_rfcAlphabet.
+ * @param[in] layout Line length, group length and their separators.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeBytesLayout(char *encodedString,
+                                          size_t encodedSize,
+                                          const uint8_t *srcBytes,
+                                          size_t srcLength,
+                                          const base32_alphabet *alphabet,
+                                          const baseX_layout *layout);
+
+/**
+ * @brief Returns the number of characters base32_encodeBytesLayout() writes
+ * for srcLength bytes, without NULL-terminator.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @param[in] alphabet Alphabet of the output.
+ * @param[in] layout The layout of the output.
+ * @return size_t Number of characters including the separators, SIZE_MAX if
+ * not representable or if the layout is invalid.
+ */
+size_t base32_encodedLengthLayout(size_t srcLength,
+                                  const base32_alphabet *alphabet,
+                                  const baseX_layout *layout);
+
+/**
+ * @brief Returns the number of characters base32_encodeBytes() writes
+ * for srcLength bytes including padding.
+ *
+ * The NULL-terminator is not included, the output buffer must be one
+ * character larger.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @return size_t Number of characters, SIZE_MAX if not representable.
+ */
+size_t base32_encodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the maximum number of bytes decoded from srcLength
+ * characters.
+ *
+ * Exact for unpadded input, padded input decodes to less bytes.
+ *
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Maximum number of decoded bytes.
+ */
+size_t base32_maxDecodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the number of bytes base32_decodeN() writes for the
+ * given input.
+ *
+ * Only the trailing padding characters are inspected, the input is not
+ * validated.
+ *
+ * @param[in] srcString Encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return size_t Number of decoded bytes of a valid input.
+ */
+size_t base32_decodedLength(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Initializes an incremental base32 encoder.
+ *
+ * Encoding the input in arbitrary chunks with base32_encodeUpdate() and
+ * finishing with base32_encodeFinal() produces the same characters as
+ * base32_encodeBytes() on the whole input. The output is not NULL-terminated.
+ *
+ * @param[out] ctx Encoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeInit(base32_encodeContext *ctx);
+
+/**
+ * @brief Encodes the next chunk of bytes.
+ *
+ * Only complete 5 byte groups are encoded, the remaining bytes are kept in
+ * the context. The output buffer must hold
+ * ((pending bytes + srcLength) / 5) * 8 characters, otherwise nothing is
+ * consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base32 characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written.
+ * @param[in] srcBytes Pointer to the next input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeUpdate(base32_encodeContext *ctx,
+                                     char *encodedString,
+                                     size_t encodedSize,
+                                     size_t *encodedLength,
+                                     const uint8_t *srcBytes,
+                                     size_t srcLength);
+
+/**
+ * @brief Encodes the last incomplete group including its padding.
+ *
+ * Writes 0 or 8 characters. The context has to be initialized again before
+ * it is reused.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base32 characters.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeFinal(base32_encodeContext *ctx,
+                                    char *encodedString,
+                                    size_t encodedSize,
+                                    size_t *encodedLength);
+
+/**
+ * @brief Initializes an incremental base32 decoder.
+ *
+ * Decoding the characters in arbitrary chunks with base32_decodeUpdate() and
+ * finishing with base32_decodeFinal() produces the same bytes as
+ * base32_decodeString() on the whole input.
+ *
+ * @param[out] ctx Decoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeInit(base32_decodeContext *ctx);
+
+/**
+ * @brief Decodes the next chunk of base32 characters.
+ *
+ * Only complete 8 character groups are decoded, the remaining characters are
+ * kept in the context. The output buffer must hold
+ * ((pending characters + srcLength) / 8) * 5 bytes, otherwise nothing is
+ * consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written.
+ * @param[in] srcString Next base32 characters, not NULL-terminated.
+ * @param[in] srcLength Number of characters.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeUpdate(base32_decodeContext *ctx,
+                                     uint8_t *decodedBytes,
+                                     size_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     const char *srcString,
+                                     size_t srcLength);
+
+/**
+ * @brief Decodes the last incomplete group.
+ *
+ * Writes at most 4 bytes. The context has to be initialized again before it
+ * is reused.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeFinal(base32_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength);
+
+/**
+ * @brief Encodes many inputs into one contiguous output arena.
+ *
+ * The arguments and the output size are checked once for the whole batch.
+ * The output of item i is written to arena[offsets[i]] up to
+ * arena[offsets[i + 1]] and is not NULL-terminated.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] arenaSize Size of the output buffer.
+ * @param[out] offsets Start of every output, count + 1 entries. The last
+ * entry is the total output length.
+ * @param[in] items Inputs to encode.
+ * @param[in] count Number of items.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_encodeBatch(char *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count);
+
+/**
+ * @brief Decodes many inputs into one contiguous output arena.
+ *
+ * Every item is decoded like base32_decodeN(). The arguments and the output
+ * size are checked once for the whole batch. The output of item i is
+ * written to arena[offsets[i]] up to arena[offsets[i + 1]].
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] arenaSize Size of the output buffer.
+ * @param[out] offsets Start of every output, count + 1 entries. The last
+ * entry is the total output length.
+ * @param[in] items Inputs to decode.
+ * @param[in] count Number of items.
+ * @param[out] errorItem Index of the item which failed to decode, may be
+ * NULL.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base32_decodeBatch(uint8_t *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count,
+                                    size_t *errorItem);
 
 #ifdef __cplusplus
 }
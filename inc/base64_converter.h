@@ -0,0 +1,180 @@
+/**
+ * @file base64_converter.h
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Converter to convert bytes to base 64 and vis-versa.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASE64_CONVERTER_H
+#define BASE64_CONVERTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "baseX_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define BASE64_BIT_LENGTH (6)  ///< Bit length of base64 input
+#define BASE64_GROUP_BYTES (3) ///< Number of bytes in a full base64 group
+#define BASE64_GROUP_CHARS (4) ///< Number of characters in a full group
+
+#define BASE64_STANDARD (0x00) ///< Standard alphabet with padding, RFC 4648 §4
+#define BASE64_URL (0x01)      ///< URL and filename safe alphabet, RFC 4648 §5
+#define BASE64_NOPAD (0x02)    ///< No padding characters
+
+/// Number of padded characters of n encoded bytes, without NULL-terminator.
+/// Does not check for overflow, use base64_encodedLength() at runtime.
+#define BASE64_ENCODED_LENGTH(n)                                               \
+  (((n) + BASE64_GROUP_BYTES - 1) / BASE64_GROUP_BYTES * BASE64_GROUP_CHARS)
+/// Number of characters of n encoded bytes with BASE64_NOPAD
+#define BASE64_ENCODED_LENGTH_NOPAD(n)                                         \
+  ((n) / BASE64_GROUP_BYTES * BASE64_GROUP_CHARS +                             \
+   ((n) % BASE64_GROUP_BYTES ? (n) % BASE64_GROUP_BYTES + 1 : 0))
+/// Maximum number of bytes decoded from n characters
+#define BASE64_MAX_DECODED_LENGTH(n)                                           \
+  ((n) / BASE64_GROUP_CHARS * BASE64_GROUP_BYTES +                             \
+   (n) % BASE64_GROUP_CHARS * BASE64_BIT_LENGTH / 8)
+
+/**
+ * @brief Decodes a base64-encoded string into a byte array.
+ *
+ * This function decodes a base64-encoded string back into its original
+ * byte representation based on RFC 4648. Without BASE64_NOPAD the input
+ * length has to be a multiple of 4 and may end with up to 2 padding
+ * characters. With BASE64_NOPAD padding characters are rejected.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString NULL-terminated base64-encoded input string.
+ * @param[in] options Combination of BASE64_URL and BASE64_NOPAD.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base64_decodeString(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     uint8_t options);
+
+/**
+ * @brief Decodes a base64-encoded character sequence of known length.
+ *
+ * Same as base64_decodeString(), but the input is given by pointer and
+ * length and does not need to be NULL-terminated.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte array.
+ * @param[out] decodedLength Pointer to store the actual number of decoded
+ * bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base64-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] options Combination of BASE64_URL and BASE64_NOPAD.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base64_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength,
+                                uint8_t options);
+
+/**
+ * @brief Decodes base64 characters over the input buffer.
+ *
+ * Same as base64_decodeN(), but the decoded bytes are written to the start
+ * of the buffer holding the characters. The decoder never writes ahead of the
+ * character it reads, so no second buffer is needed. On an error the content
+ * of the buffer is undefined.
+ *
+ * @param[in,out] buffer base64-encoded characters, decoded bytes on return.
+ * @param[in] length Number of characters in buffer.
+ * @param[out] decodedLength Pointer to store the number of decoded bytes.
+ * @param[in] options Same options as for base64_decodeN().
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base64_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength,
+                                      uint8_t options);
+
+/**
+ * @brief Encodes a byte array into a base64-encoded string (RFC 4648).
+ *
+ * This function converts the input byte array into a base64-encoded string
+ * using the standard or the URL safe alphabet. The output string will be
+ * null-terminated.
+ *
+ * @param[out] encodedString Buffer to store the base64-encoded string.
+ * @param[in] encodedSize Size of the output buffer in bytes.
+ * @param[in] srcBytes Pointer to the input byte array.
+ * @param[in] srcLength Length of the input byte array in bytes.
+ * @param[in] options Combination of BASE64_URL and BASE64_NOPAD.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base64_encodeBytes(char *encodedString,
+                                    size_t encodedSize,
+                                    const uint8_t *srcBytes,
+                                    size_t srcLength,
+                                    uint8_t options);
+
+/**
+ * @brief Returns the number of characters base64_encodeBytes() writes
+ * for srcLength bytes with the given options.
+ *
+ * The NULL-terminator is not included, the output buffer must be one
+ * character larger.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @param[in] options Combination of BASE64_URL and BASE64_NOPAD.
+ * @return size_t Number of characters, SIZE_MAX if not representable.
+ */
+size_t base64_encodedLength(size_t srcLength, uint8_t options);
+
+/**
+ * @brief Returns the maximum number of bytes decoded from srcLength
+ * characters.
+ *
+ * Exact for unpadded input, padded input decodes to less bytes.
+ *
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Maximum number of decoded bytes.
+ */
+size_t base64_maxDecodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the number of bytes base64_decodeN() writes for the
+ * given input.
+ *
+ * Only the trailing padding characters are inspected, the input is not
+ * validated.
+ *
+ * @param[in] srcString Encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return size_t Number of decoded bytes of a valid input.
+ */
+size_t base64_decodedLength(const char *srcString, size_t srcLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CONVERTER_H */
@@ -29,11 +29,49 @@ extern "C" {
 #endif
 
 #include "baseX_types.h"
+#include <stddef.h>
 #include <stdint.h>
 
 #define BASE8_BIT_LENGTH (3)  ///< Bit length of base8 input
 #define BASE8_STARTCHAR ('1') ///< Start character of a base8 input
 #define BASE8_ENDCHAR ('8')   ///< End character of a base8 input
+#define BASE8_GROUP_BYTES (3) ///< Number of bytes in a full base8 group
+#define BASE8_GROUP_CHARS (8) ///< Number of characters in a full base8 group
+
+/// Number of characters of n encoded bytes, without NULL-terminator.
+/// Does not check for overflow, use base8_encodedLength() at runtime.
+#define BASE8_ENCODED_LENGTH(n)                                                \
+  ((n) / BASE8_GROUP_BYTES * BASE8_GROUP_CHARS +                               \
+   (n) % BASE8_GROUP_BYTES * BASE8_BIT_LENGTH)
+/// Number of bytes decoded from n characters
+#define BASE8_MAX_DECODED_LENGTH(n)                                            \
+  ((n) / BASE8_GROUP_CHARS * BASE8_GROUP_BYTES +                               \
+   (n) % BASE8_GROUP_CHARS / BASE8_BIT_LENGTH)
+
+/**
+ * @brief State of an incremental base8 encoder.
+ *
+ * Carries the incomplete 3 byte group and the number of set bits of all
+ * emitted characters, which is needed for the check bits of the last group.
+ */
+typedef struct {
+  uint8_t group[BASE8_GROUP_BYTES]; ///< Bytes of the incomplete group
+  uint8_t groupLength;              ///< Number of bytes in group
+  uint32_t numberOfBits;            ///< Set bits of all emitted characters
+} base8_encodeContext;
+
+/**
+ * @brief State of an incremental base8 decoder.
+ *
+ * Carries the incomplete 8 character group and the number of set bits of all
+ * received characters.
+ */
+typedef struct {
+  uint8_t group[BASE8_GROUP_CHARS]; ///< Numbers of the incomplete group
+  uint8_t groupLength;              ///< Number of numbers in group
+  uint8_t started;                  ///< At least one character received
+  uint32_t numberOfBits;            ///< Set bits of all decoded numbers
+} base8_decodeContext;
 
 /**
  * @brief Encodes a byte array into a base8-encoded string.
@@ -48,9 +86,124 @@ extern "C" {
  * @return baseX_returnType Status code.
  */
 baseX_returnType base8_encodeBytes(uint8_t *encodedString,
-                                   uint32_t encodedStringSize,
+                                   size_t encodedStringSize,
                                    const uint8_t *srcBytes,
-                                   uint32_t srcBytesSize);
+                                   size_t srcBytesSize);
+
+/**
+ * @brief Returns the number of characters base8_encodeBytes() writes
+ * for srcLength bytes including the check number.
+ *
+ * The NULL-terminator is not included, the output buffer must be one
+ * character larger.
+ *
+ * @param[in] srcLength Number of bytes to encode.
+ * @return size_t Number of characters, SIZE_MAX if not representable.
+ */
+size_t base8_encodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the maximum number of bytes decoded from srcLength
+ * characters.
+ *
+ * Base8 has no padding, so this is the exact length of a valid input.
+ *
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Maximum number of decoded bytes.
+ */
+size_t base8_maxDecodedLength(size_t srcLength);
+
+/**
+ * @brief Returns the number of bytes base8_decodeN() writes for the
+ * given input.
+ *
+ * The input is not inspected, the length is the same as
+ * base8_maxDecodedLength() and is provided for the same interface as the
+ * other bases.
+ *
+ * @param[in] srcString Encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return size_t Number of decoded bytes of a valid input.
+ */
+size_t base8_decodedLength(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Decodes a base8-encoded string into a byte array.
+ *
+ * Validates the characters, packs 8 characters into 3 bytes and verifies
+ * the check number of an incomplete group in a single pass. Same result as
+ * base8_stringToNum() followed by base8_decodeNum(), without the numeric
+ * buffer.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte output.
+ * @param[out] decodedLength Pointer to a variable that will hold the length of
+ * the decoded output.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString NULL-terminated base8-encoded input string.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeString(uint8_t *decodedBytes,
+                                    size_t *decodedLength,
+                                    size_t decodedBytesSize,
+                                    const char *srcString);
+
+/**
+ * @brief Decodes a base8-encoded character sequence of known length.
+ *
+ * Same as base8_decodeString(), but the input is given by pointer and length
+ * and does not need to be NULL-terminated.
+ *
+ * @param[out] decodedBytes Buffer to store the decoded byte output.
+ * @param[out] decodedLength Pointer to a variable that will hold the length of
+ * the decoded output.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString base8-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeN(uint8_t *decodedBytes,
+                               size_t *decodedLength,
+                               size_t decodedBytesSize,
+                               const char *srcString,
+                               size_t srcLength);
+
+/**
+ * @brief Decodes base8 characters over the input buffer.
+ *
+ * Same as base8_decodeN(), but the decoded bytes are written to the start
+ * of the buffer holding the characters. The decoder never writes ahead of the
+ * character it reads, so no second buffer is needed. On an error the content
+ * of the buffer is undefined.
+ *
+ * @param[in,out] buffer base8-encoded characters, decoded bytes on return.
+ * @param[in] length Number of characters in buffer.
+ * @param[out] decodedLength Pointer to store the number of decoded bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeInPlace(char *buffer,
+                                     size_t length,
+                                     size_t *decodedLength);
+
+/**
+ * @brief Checks base8 characters and their check number without decoding
+ * them.
+ *
+ * Accepts exactly the input base8_decodeN() accepts: digits '1' to '8', a
+ * length of 8 characters per group plus 0, 3 or 6 and a matching check
+ * number in the last character of an incomplete group. On x86 CPUs with
+ * SSE4.1 or AVX2 the digits are checked and their set bits counted in blocks
+ * of 16 or 32.
+ *
+ * @param[in] srcString base8-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[out] errorOffset Set on BASEX_SRCERROR to the position of the first
+ * invalid character or of the wrong check number, or to srcLength if the
+ * length is wrong. May be NULL.
+ * @return baseX_returnType BASEX_OK, BASEX_SRCERROR or BASEX_ARGUMENTS.
+ */
+baseX_returnType base8_validate(const char *srcString,
+                                size_t srcLength,
+                                size_t *errorOffset);
 
 /**
  * @brief Converts a base8-encoded string into a numeric representation.
@@ -64,6 +217,23 @@ baseX_returnType base8_encodeBytes(uint8_t *encodedString,
  */
 baseX_returnType base8_stringToNum(uint8_t *number, const char *srcString);
 
+/**
+ * @brief Converts a base8-encoded character sequence of known length into a
+ * numeric representation.
+ *
+ * Same as base8_stringToNum(), but the input is given by pointer and length
+ * and does not need to be NULL-terminated.
+ *
+ * @param[out] number Buffer to store the resulting numeric representation,
+ * at least srcLength bytes.
+ * @param[in] srcString base8-encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_stringToNumN(uint8_t *number,
+                                    const char *srcString,
+                                    size_t srcLength);
+
 /**
  * @brief Decodes a base8-encoded numeric array into its original byte form.
  *
@@ -79,10 +249,114 @@ baseX_returnType base8_stringToNum(uint8_t *number, const char *srcString);
  * @return baseX_returnType Status code.
  */
 baseX_returnType base8_decodeNum(uint8_t *decodedBytes,
-                                 uint32_t *decodedLength,
-                                 uint32_t decodedBytesSize,
+                                 size_t *decodedLength,
+                                 size_t decodedBytesSize,
                                  const uint8_t *srcNumbers,
-                                 const uint32_t srcLength);
+                                 const size_t srcLength);
+
+/**
+ * @brief Initializes an incremental base8 encoder.
+ *
+ * Encoding the input in arbitrary chunks with base8_encodeUpdate() and
+ * finishing with base8_encodeFinal() produces the same characters as
+ * base8_encodeBytes() on the whole input. The output is not NULL-terminated.
+ *
+ * @param[out] ctx Encoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_encodeInit(base8_encodeContext *ctx);
+
+/**
+ * @brief Encodes the next chunk of bytes.
+ *
+ * Only complete 3 byte groups are encoded, the remaining bytes are kept in
+ * the context. The output buffer must hold
+ * ((pending bytes + srcBytesSize) / 3) * 8 characters, otherwise nothing is
+ * consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base8 characters.
+ * @param[in] encodedStringSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written.
+ * @param[in] srcBytes Pointer to the next input bytes.
+ * @param[in] srcBytesSize Number of input bytes.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_encodeUpdate(base8_encodeContext *ctx,
+                                    uint8_t *encodedString,
+                                    size_t encodedStringSize,
+                                    size_t *encodedLength,
+                                    const uint8_t *srcBytes,
+                                    size_t srcBytesSize);
+
+/**
+ * @brief Encodes the last incomplete group including its check bits.
+ *
+ * Writes at most 6 characters. The context has to be initialized again
+ * before it is reused.
+ *
+ * @param[in,out] ctx Encoder state.
+ * @param[out] encodedString Buffer to store the base8 characters.
+ * @param[in] encodedStringSize Size of the output buffer in bytes.
+ * @param[out] encodedLength Number of characters written.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_encodeFinal(base8_encodeContext *ctx,
+                                   uint8_t *encodedString,
+                                   size_t encodedStringSize,
+                                   size_t *encodedLength);
+
+/**
+ * @brief Initializes an incremental base8 decoder.
+ *
+ * Decoding the characters in arbitrary chunks with base8_decodeUpdate() and
+ * finishing with base8_decodeFinal() produces the same bytes as
+ * base8_decodeN() on the whole input.
+ *
+ * @param[out] ctx Decoder state to initialize.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeInit(base8_decodeContext *ctx);
+
+/**
+ * @brief Decodes the next chunk of base8 characters.
+ *
+ * Only complete 8 character groups are decoded, the remaining characters are
+ * kept in the context. The output buffer must hold
+ * ((pending characters + srcLength) / 8) * 3 bytes, otherwise nothing is
+ * consumed and BASEX_OVERFLOW is returned.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written.
+ * @param[in] srcString Next base8 characters, not NULL-terminated.
+ * @param[in] srcLength Number of characters.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeUpdate(base8_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength,
+                                    const char *srcString,
+                                    size_t srcLength);
+
+/**
+ * @brief Decodes the last incomplete group and verifies its check bits.
+ *
+ * Writes at most 2 bytes. The context has to be initialized again before it
+ * is reused.
+ *
+ * @param[in,out] ctx Decoder state.
+ * @param[out] decodedBytes Buffer to store the decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[out] decodedLength Number of bytes written.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType base8_decodeFinal(base8_decodeContext *ctx,
+                                   uint8_t *decodedBytes,
+                                   size_t decodedBytesSize,
+                                   size_t *decodedLength);
 
 #ifdef __cplusplus
 }
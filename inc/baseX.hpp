@@ -0,0 +1,651 @@
+/**
+ * @file baseX.hpp
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Header-only C++20 interface of the base8, base16, base32 and base64
+ * converters.
+ *
+ * The bases are selected with the tag types Base8, Base16, Base32, Base64
+ * and Base64Url, e.g. baseX::encode<baseX::Base32>(bytes, buffer). The
+ * alphabets and their reverse tables are built at compile time. In a
+ * constant expression the conversion runs on these tables, at runtime the
+ * calls are forwarded to the C library. Both produce the same output and
+ * accept the same input as the C functions.
+ *
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASEX_HPP
+#define BASEX_HPP
+
+#if __cplusplus < 202002L
+#error "baseX.hpp requires C++20"
+#endif
+
+#include "base16_converter.h"
+#include "base32_converter.h"
+#include "base64_converter.h"
+#include "base8_converter.h"
+#include "baseX_types.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace baseX {
+
+/**
+ * @brief Base8 with the characters '1'-'8' and a check number.
+ *
+ */
+struct Base8 {
+  static constexpr std::size_t bits = BASE8_BIT_LENGTH;
+  static constexpr std::size_t groupBytes = BASE8_GROUP_BYTES;
+  static constexpr std::size_t groupChars = BASE8_GROUP_CHARS;
+  static constexpr std::string_view alphabet = "12345678";
+  static constexpr bool ignoreCase = false;
+
+  static constexpr std::size_t encodedLength(std::size_t n)
+  {
+    return BASE8_ENCODED_LENGTH(n);
+  }
+  static constexpr std::size_t maxDecodedLength(std::size_t n)
+  {
+    return BASE8_MAX_DECODED_LENGTH(n);
+  }
+};
+
+/**
+ * @brief Base16 with uppercase output, decodes both cases.
+ *
+ */
+struct Base16 {
+  static constexpr std::size_t bits = 4;
+  static constexpr std::size_t groupBytes = 1;
+  static constexpr std::size_t groupChars = 2;
+  static constexpr std::string_view alphabet = "0123456789ABCDEF";
+  static constexpr bool ignoreCase = true;
+
+  static constexpr std::size_t encodedLength(std::size_t n)
+  {
+    return BASE16_ENCODED_LENGTH(n);
+  }
+  static constexpr std::size_t maxDecodedLength(std::size_t n)
+  {
+    return BASE16_MAX_DECODED_LENGTH(n);
+  }
+};
+
+/**
+ * @brief Base32 (RFC 4648 §6) with padding, decodes both cases.
+ *
+ */
+struct Base32 {
+  static constexpr std::size_t bits = BASE32_BIT_LENGTH;
+  static constexpr std::size_t groupBytes = BASE32_GROUP_BYTES;
+  static constexpr std::size_t groupChars = BASE32_GROUP_CHARS;
+  static constexpr std::string_view alphabet =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+  static constexpr bool ignoreCase = true;
+
+  static constexpr std::size_t encodedLength(std::size_t n)
+  {
+    return BASE32_ENCODED_LENGTH(n);
+  }
+  static constexpr std::size_t maxDecodedLength(std::size_t n)
+  {
+    return BASE32_MAX_DECODED_LENGTH(n);
+  }
+};
+
+/**
+ * @brief Base64 (RFC 4648 §4) with padding.
+ *
+ */
+struct Base64 {
+  static constexpr std::size_t bits = BASE64_BIT_LENGTH;
+  static constexpr std::size_t groupBytes = BASE64_GROUP_BYTES;
+  static constexpr std::size_t groupChars = BASE64_GROUP_CHARS;
+  static constexpr std::string_view alphabet =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  static constexpr bool ignoreCase = false;
+  static constexpr std::uint8_t options = BASE64_STANDARD;
+
+  static constexpr std::size_t encodedLength(std::size_t n)
+  {
+    return BASE64_ENCODED_LENGTH(n);
+  }
+  static constexpr std::size_t maxDecodedLength(std::size_t n)
+  {
+    return BASE64_MAX_DECODED_LENGTH(n);
+  }
+};
+
+/**
+ * @brief URL and filename safe base64 (RFC 4648 §5) with padding.
+ *
+ */
+struct Base64Url : Base64 {
+  static constexpr std::string_view alphabet =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  static constexpr std::uint8_t options = BASE64_URL;
+};
+
+/**
+ * @brief Status and output length of a conversion.
+ *
+ */
+struct result {
+  baseX_returnType status; ///< Status code of the conversion
+  std::size_t length;      ///< Number of written elements, 0 on an error
+
+  constexpr explicit operator bool() const noexcept
+  {
+    return BASEX_OK == status;
+  }
+};
+
+/**
+ * @brief Bytes decoded at compile time by decodeLiteral().
+ *
+ * @tparam N Capacity, the maximum decoded length of the literal.
+ */
+template <std::size_t N>
+struct decodedBytes {
+  std::array<std::byte, N> data{}; ///< Decoded bytes, zero behind length
+  std::size_t length = 0;          ///< Number of decoded bytes
+
+  constexpr std::span<const std::byte> bytes() const noexcept
+  {
+    return {data.data(), length};
+  }
+};
+
+/**
+ * @brief Number of characters of n encoded bytes, without NULL-terminator.
+ *
+ */
+template <class Base>
+constexpr std::size_t encodedLength(std::size_t n) noexcept
+{
+  return Base::encodedLength(n);
+}
+
+/**
+ * @brief Maximum number of bytes decoded from n characters.
+ *
+ */
+template <class Base>
+constexpr std::size_t maxDecodedLength(std::size_t n) noexcept
+{
+  return Base::maxDecodedLength(n);
+}
+
+namespace detail {
+
+inline constexpr std::uint8_t invalid = 0xFF;
+inline constexpr char paddingCharacter = '=';
+
+template <class Base>
+constexpr std::array<std::uint8_t, 256> makeReverseTable()
+{
+  std::array<std::uint8_t, 256> table{};
+  table.fill(invalid);
+  for (std::size_t i = 0; i < Base::alphabet.size(); i++) {
+    auto c = static_cast<unsigned char>(Base::alphabet[i]);
+    table[c] = static_cast<std::uint8_t>(i);
+    if (Base::ignoreCase && 'A' <= c && c <= 'Z') {
+      table[c | 0x20u] = static_cast<std::uint8_t>(i);
+    }
+  }
+  return table;
+}
+
+/// Value of every character, invalid for characters outside the alphabet
+template <class Base>
+inline constexpr std::array<std::uint8_t, 256> reverseTable =
+    makeReverseTable<Base>();
+
+template <class Base>
+constexpr std::uint8_t value(char c)
+{
+  return reverseTable<Base>[static_cast<unsigned char>(c)];
+}
+
+template <class Base>
+inline constexpr bool isBase64 = std::is_base_of_v<Base64, Base>;
+
+/**
+ * @brief Encodes base16, base32 and base64 like the C encoders, padded to
+ * full groups.
+ *
+ */
+template <class Base>
+constexpr void encodeGroups(char *dst, std::span<const std::byte> src)
+{
+  constexpr std::uint64_t mask = (1u << Base::bits) - 1;
+  for (std::size_t rPos = 0; rPos < src.size(); rPos += Base::groupBytes) {
+    std::size_t length = src.size() - rPos;
+    if (length > Base::groupBytes) {
+      length = Base::groupBytes;
+    }
+    std::uint64_t group = 0;
+    for (std::size_t i = 0; i < Base::groupBytes; i++) {
+      group <<= BASEX_BYTE_BIT_LENGTH;
+      if (i < length) {
+        group |= std::to_integer<std::uint64_t>(src[rPos + i]);
+      }
+    }
+    std::size_t chars =
+        (length * BASEX_BYTE_BIT_LENGTH + Base::bits - 1) / Base::bits;
+    for (std::size_t i = 0; i < Base::groupChars; i++) {
+      std::size_t shift = (Base::groupChars - 1 - i) * Base::bits;
+      *dst++ = (i < chars) ? Base::alphabet[(group >> shift) & mask]
+                           : paddingCharacter;
+    }
+  }
+}
+
+/**
+ * @brief Encodes base8 like base8_encodeBytes(), including the check number.
+ *
+ */
+constexpr void encodeBase8(char *dst, std::span<const std::byte> src)
+{
+  std::uint32_t numberOfBits = 0;
+  for (std::size_t rPos = 0; rPos < src.size(); rPos += Base8::groupBytes) {
+    std::size_t length = src.size() - rPos;
+    if (length > Base8::groupBytes) {
+      length = Base8::groupBytes;
+    }
+    std::uint32_t group = 0;
+    for (std::size_t i = 0; i < length; i++) {
+      group |= std::to_integer<std::uint32_t>(src[rPos + i])
+               << (16 - BASEX_BYTE_BIT_LENGTH * i);
+    }
+    // 3 bytes need 8 characters, 1 byte 3 and 2 bytes 6 characters
+    std::size_t chars = (Base8::groupBytes == length) ? Base8::groupChars
+                                                      : length * Base8::bits;
+    for (std::size_t i = 0; i < chars; i++) {
+      std::uint32_t number = (group >> (21 - Base8::bits * i)) & 0x07;
+      if (Base8::groupBytes != length && chars - 1 == i) {
+        // The last character carries the check bits
+        number += numberOfBits % static_cast<std::uint32_t>(2 * length);
+      } else {
+        numberOfBits += static_cast<std::uint32_t>(std::popcount(number));
+      }
+      *dst++ = Base8::alphabet[number];
+    }
+  }
+}
+
+constexpr result decodeBase8(std::span<std::byte> dst, std::string_view src)
+{
+  std::size_t tailLength = src.size() % Base8::groupChars;
+  if (0 != tailLength % Base8::bits) {
+    return {BASEX_SRCERROR, 0};
+  }
+  std::size_t outputLength = maxDecodedLength<Base8>(src.size());
+  if (outputLength > dst.size()) {
+    return {BASEX_OVERFLOW, 0};
+  }
+  std::uint32_t numberOfBits = 0;
+  std::size_t wPos = 0;
+  for (std::size_t rPos = 0; rPos < src.size(); rPos += Base8::groupChars) {
+    std::size_t length = src.size() - rPos;
+    if (length > Base8::groupChars) {
+      length = Base8::groupChars;
+    }
+    std::uint32_t group = 0;
+    std::uint32_t number = 0;
+    for (std::size_t i = 0; i < length; i++) {
+      number = value<Base8>(src[rPos + i]);
+      if (invalid == number) {
+        return {BASEX_SRCERROR, 0};
+      }
+      group = (group << Base8::bits) | number;
+      numberOfBits += static_cast<std::uint32_t>(std::popcount(number));
+    }
+    std::size_t bytes = Base8::groupBytes;
+    if (Base8::groupChars != length) {
+      // Remove the check bits, 1 for a single byte and 2 for two bytes
+      bytes = length / Base8::bits;
+      numberOfBits -= static_cast<std::uint32_t>(std::popcount(number));
+      if ((group & ((1u << bytes) - 1)) != numberOfBits % (2 * bytes)) {
+        return {BASEX_SRCERROR, 0};
+      }
+      group >>= bytes;
+    }
+    for (std::size_t i = 0; i < bytes; i++) {
+      dst[wPos++] = static_cast<std::byte>(
+          group >> (BASEX_BYTE_BIT_LENGTH * (bytes - 1 - i)));
+    }
+  }
+  return {BASEX_OK, outputLength};
+}
+
+constexpr result decodeBase16(std::span<std::byte> dst, std::string_view src)
+{
+  if (src.size() % Base16::groupChars) {
+    return {BASEX_SRCERROR, 0};
+  }
+  std::size_t outputLength = maxDecodedLength<Base16>(src.size());
+  if (outputLength > dst.size()) {
+    return {BASEX_OVERFLOW, 0};
+  }
+  for (std::size_t i = 0; i < outputLength; i++) {
+    std::uint8_t high = value<Base16>(src[2 * i]);
+    std::uint8_t low = value<Base16>(src[2 * i + 1]);
+    if (invalid == high || invalid == low) {
+      return {BASEX_SRCERROR, 0};
+    }
+    dst[i] = static_cast<std::byte>((high << 4) | low);
+  }
+  return {BASEX_OK, outputLength};
+}
+
+/// Number of padding characters behind a base32 output of length bytes
+constexpr std::size_t base32PaddingLength(std::size_t length)
+{
+  constexpr std::uint8_t padding[BASE32_GROUP_BYTES] = {0, 6, 4, 3, 1};
+  return padding[length % BASE32_GROUP_BYTES];
+}
+
+/**
+ * @brief Decodes base32 like base32_decodeN(), padding is optional.
+ *
+ */
+constexpr result decodeBase32(std::span<std::byte> dst, std::string_view src)
+{
+  std::size_t wPos = 0;
+  std::size_t rPos = 0;
+  std::uint32_t bits = 0;
+  std::uint32_t vbit = 0;
+  while ((rPos < src.size()) || (vbit >= 8)) {
+    // A full buffer is only accepted if the padding follows
+    if ((wPos >= dst.size()) &&
+        ((vbit >= 8) || (paddingCharacter != src[rPos]))) {
+      return {BASEX_OVERFLOW, 0};
+    }
+    if ((rPos < src.size()) && (vbit < 8)) {
+      char c = src[rPos++];
+      if (paddingCharacter == c) {
+        std::size_t expectedPadding = base32PaddingLength(wPos);
+        for (std::size_t i = 1; i < expectedPadding && rPos < src.size();
+             i++, rPos++) {
+          if (paddingCharacter != src[rPos]) {
+            return {BASEX_SRCERROR, 0};
+          }
+        }
+        if (rPos < src.size()) {
+          return {BASEX_SRCERROR, 0};
+        }
+        break;
+      }
+      std::uint8_t number = value<Base32>(c);
+      if (invalid == number) {
+        return {BASEX_SRCERROR, 0};
+      }
+      bits = (bits << Base32::bits) | number;
+      vbit += Base32::bits;
+    }
+    if (vbit >= 8) {
+      dst[wPos++] = static_cast<std::byte>(bits >> (vbit - 8));
+      vbit -= 8;
+    }
+  }
+  return {BASEX_OK, wPos};
+}
+
+/**
+ * @brief Decodes padded base64 like base64_decodeN().
+ *
+ */
+template <class Base>
+constexpr result decodeBase64(std::span<std::byte> dst, std::string_view src)
+{
+  if (src.size() % Base::groupChars) {
+    return {BASEX_SRCERROR, 0};
+  }
+  std::size_t dataLength = src.size();
+  for (int i = 0; i < 2 && paddingCharacter == src[dataLength - 1]; i++) {
+    dataLength--;
+  }
+  std::size_t tailLength = dataLength % Base::groupChars;
+  if (1 == tailLength) {
+    return {BASEX_SRCERROR, 0};
+  }
+  std::size_t outputLength = dataLength / Base::groupChars * Base::groupBytes +
+                             (tailLength ? tailLength - 1 : 0);
+  if (outputLength > dst.size()) {
+    return {BASEX_OVERFLOW, 0};
+  }
+  std::size_t wPos = 0;
+  for (std::size_t rPos = 0; rPos < dataLength; rPos += Base::groupChars) {
+    std::size_t length = dataLength - rPos;
+    if (length > Base::groupChars) {
+      length = Base::groupChars;
+    }
+    std::uint32_t group = 0;
+    for (std::size_t i = 0; i < Base::groupChars; i++) {
+      std::uint8_t number = 0;
+      if (i < length) {
+        number = value<Base>(src[rPos + i]);
+        if (invalid == number) {
+          return {BASEX_SRCERROR, 0};
+        }
+      }
+      group = (group << Base::bits) | number;
+    }
+    for (std::size_t i = 0; i + 1 < length; i++) {
+      dst[wPos++] =
+          static_cast<std::byte>(group >> (BASEX_BYTE_BIT_LENGTH * (2 - i)));
+    }
+  }
+  return {BASEX_OK, outputLength};
+}
+
+template <class Base>
+result encodeRuntime(std::span<char> dst, std::span<const std::byte> src)
+{
+  const auto *bytes = reinterpret_cast<const std::uint8_t *>(src.data());
+  std::size_t length = encodedLength<Base>(src.size());
+  if constexpr (std::is_same_v<Base, Base8>) {
+    base8_encodeContext ctx;
+    std::size_t written = 0;
+    std::size_t tail = 0;
+    auto *out = reinterpret_cast<std::uint8_t *>(dst.data());
+    base8_encodeInit(&ctx);
+    baseX_returnType status =
+        base8_encodeUpdate(&ctx, out, dst.size(), &written, bytes, src.size());
+    if (BASEX_OK == status) {
+      status = base8_encodeFinal(&ctx, out + written, dst.size() - written,
+                                 &tail);
+    }
+    return {status, (BASEX_OK == status) ? written + tail : 0};
+  } else if constexpr (isBase64<Base>) {
+    // base64_encodeBytes() needs room for the NULL-terminator
+    if (dst.size() > length) {
+      baseX_returnType status = base64_encodeBytes(
+          dst.data(), dst.size(), bytes, src.size(), Base::options);
+      return {status, (BASEX_OK == status) ? length : 0};
+    }
+    encodeGroups<Base>(dst.data(), src);
+    return {BASEX_OK, length};
+  } else {
+    std::size_t offsets[2];
+    const baseX_batchItem item = {src.data(), src.size()};
+    baseX_returnType status =
+        std::is_same_v<Base, Base16>
+            ? base16_encodeBatch(dst.data(), dst.size(), offsets, &item, 1)
+            : base32_encodeBatch(dst.data(), dst.size(), offsets, &item, 1);
+    return {status, (BASEX_OK == status) ? length : 0};
+  }
+}
+
+template <class Base>
+result decodeRuntime(std::span<std::byte> dst, std::string_view src)
+{
+  // The C decoders reject a NULL buffer, even if it is not written
+  std::byte empty[1];
+  auto *out = reinterpret_cast<std::uint8_t *>(dst.empty() ? empty
+                                                           : dst.data());
+  std::size_t length = 0;
+  baseX_returnType status;
+  if constexpr (std::is_same_v<Base, Base8>) {
+    status = base8_decodeN(out, &length, dst.size(), src.data(), src.size());
+  } else if constexpr (std::is_same_v<Base, Base16>) {
+    status = base16_decodeN(out, &length, dst.size(), src.data(), src.size());
+  } else if constexpr (std::is_same_v<Base, Base32>) {
+    status = base32_decodeN(out, &length, dst.size(), src.data(), src.size());
+  } else {
+    status = base64_decodeN(out, &length, dst.size(), src.data(), src.size(),
+                            Base::options);
+  }
+  return {status, (BASEX_OK == status) ? length : 0};
+}
+
+/// Not a constant expression, reports an invalid literal at compile time
+inline void invalidLiteral() {}
+
+} // namespace detail
+
+/**
+ * @brief Encodes the bytes into the buffer, without NULL-terminator.
+ *
+ * @tparam Base Base8, Base16, Base32, Base64 or Base64Url.
+ * @param[in] src Input bytes.
+ * @param[out] dst Output buffer, at least encodedLength<Base>(src.size())
+ * characters.
+ * @return result BASEX_OVERFLOW if the buffer is too small.
+ */
+template <class Base>
+constexpr result encode(std::span<const std::byte> src, std::span<char> dst)
+{
+  std::size_t length = encodedLength<Base>(src.size());
+  if (length > dst.size()) {
+    return {BASEX_OVERFLOW, 0};
+  }
+  if (src.empty()) {
+    return {BASEX_OK, 0};
+  }
+  if (!std::is_constant_evaluated()) {
+    return detail::encodeRuntime<Base>(dst, src);
+  }
+  if constexpr (std::is_same_v<Base, Base8>) {
+    detail::encodeBase8(dst.data(), src);
+  } else {
+    detail::encodeGroups<Base>(dst.data(), src);
+  }
+  return {BASEX_OK, length};
+}
+
+/**
+ * @brief Encodes the bytes into a string of the encoded length.
+ *
+ * @tparam Base Base8, Base16, Base32, Base64 or Base64Url.
+ * @param[in] src Input bytes.
+ * @return std::string Encoded characters.
+ */
+template <class Base>
+constexpr std::string encode(std::span<const std::byte> src)
+{
+  std::string encoded(encodedLength<Base>(src.size()), '\0');
+  encode<Base>(src, std::span<char>(encoded));
+  return encoded;
+}
+
+/**
+ * @brief Decodes the characters into the buffer.
+ *
+ * Accepts the same input as the base specific decodeN function of the C
+ * library.
+ *
+ * @tparam Base Base8, Base16, Base32, Base64 or Base64Url.
+ * @param[in] src Encoded characters, not NULL-terminated.
+ * @param[out] dst Output buffer, maxDecodedLength<Base>(src.size()) bytes
+ * are always sufficient.
+ * @return result BASEX_SRCERROR on invalid input, BASEX_OVERFLOW if the
+ * buffer is too small.
+ */
+template <class Base>
+constexpr result decode(std::string_view src, std::span<std::byte> dst)
+{
+  if (src.empty()) {
+    return {BASEX_SRCERROR, 0};
+  }
+  if (!std::is_constant_evaluated()) {
+    return detail::decodeRuntime<Base>(dst, src);
+  }
+  if constexpr (std::is_same_v<Base, Base8>) {
+    return detail::decodeBase8(dst, src);
+  } else if constexpr (std::is_same_v<Base, Base16>) {
+    return detail::decodeBase16(dst, src);
+  } else if constexpr (std::is_same_v<Base, Base32>) {
+    return detail::decodeBase32(dst, src);
+  } else {
+    return detail::decodeBase64<Base>(dst, src);
+  }
+}
+
+/**
+ * @brief Encodes the bytes at compile time.
+ *
+ * @tparam Base Base8, Base16, Base32, Base64 or Base64Url.
+ * @param[in] src Input bytes.
+ * @return NULL-terminated characters.
+ */
+template <class Base, std::size_t N>
+consteval std::array<char, encodedLength<Base>(N) + 1>
+encodeArray(const std::array<std::byte, N> &src)
+{
+  std::array<char, encodedLength<Base>(N) + 1> encoded{};
+  encode<Base>(std::span<const std::byte>(src),
+               std::span<char>(encoded.data(), encodedLength<Base>(N)));
+  return encoded;
+}
+
+/**
+ * @brief Decodes a string literal at compile time, an invalid literal does
+ * not compile.
+ *
+ * @tparam Base Base8, Base16, Base32, Base64 or Base64Url.
+ * @param[in] src Encoded string literal.
+ * @return decodedBytes Decoded bytes and their number.
+ */
+template <class Base, std::size_t N>
+consteval decodedBytes<maxDecodedLength<Base>(N - 1)>
+decodeLiteral(const char (&src)[N])
+{
+  decodedBytes<maxDecodedLength<Base>(N - 1)> decoded{};
+  result r = decode<Base>(std::string_view(src, N - 1), decoded.data);
+  if (!r) {
+    detail::invalidLiteral();
+  }
+  decoded.length = r.length;
+  return decoded;
+}
+
+} // namespace baseX
+
+#endif /* BASEX_HPP */
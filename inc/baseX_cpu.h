@@ -0,0 +1,75 @@
+/**
+ * @file baseX_cpu.h
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Runtime CPU feature detection used to select the vectorized
+ * converter kernels.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASEX_CPU_H
+#define BASEX_CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if !defined(BASEX_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) &&  \
+    (defined(__GNUC__) || defined(__clang__))
+#define BASEX_X86_SIMD (1) ///< x86 SIMD kernels are compiled in
+#endif
+
+#if defined(BASEX_X86_SIMD) && defined(__x86_64__)
+#define BASEX_X86_BMI2 (1) ///< 64 bit PDEP/PEXT kernels are compiled in
+#endif
+
+#define BASEX_CPU_SSE41 (0x01u) ///< SSE4.1 (including SSSE3) is available
+#define BASEX_CPU_AVX2 (0x02u)  ///< AVX2 is available
+#define BASEX_CPU_BMI2 (0x04u)  ///< BMI2 with fast PDEP/PEXT is available
+#define BASEX_CPU_AVX512VBMI (0x08u) ///< AVX-512 VBMI and BW are available
+
+/**
+ * @brief Returns the CPU features the converters are allowed to use.
+ *
+ * The features are detected on the first call and cached. The result is the
+ * detected feature set restricted by the mask set with baseX_cpuSetMask().
+ * Without x86 SIMD support (or with BASEX_NO_SIMD defined) it is always 0 and
+ * every converter uses its scalar implementation.
+ *
+ * @return uint32_t Bit set of BASEX_CPU_* flags.
+ */
+uint32_t baseX_cpuFeatures(void);
+
+/**
+ * @brief Restricts the CPU features the converters are allowed to use.
+ *
+ * Features that are not detected are never enabled, so the mask can only
+ * reduce the selected kernels. Mainly used to compare the vectorized and
+ * scalar kernels in tests and benchmarks.
+ *
+ * @param[in] mask Bit set of BASEX_CPU_* flags, UINT32_MAX enables all.
+ */
+void baseX_cpuSetMask(uint32_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASEX_CPU_H */
@@ -0,0 +1,81 @@
+/**
+ * @file baseX_ignore.h
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Sets of characters the tolerant decoders skip, e.g. line breaks of
+ * wrapped input.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASEX_IGNORE_H
+#define BASEX_IGNORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "baseX_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Resolved set of ignorable ASCII characters.
+ *
+ * Use the prebuilt baseX_whitespace or resolve a custom set once with
+ * baseX_ignoreInit().
+ */
+typedef struct {
+  uint8_t nibbles[16];     ///< Bit h of entry l is set for character 0xhl
+  uint8_t characters[256]; ///< 1 for every ignorable character
+} baseX_ignoreSet;
+
+/// Space, horizontal and vertical tab, line feed, form feed and carriage return
+extern const baseX_ignoreSet baseX_whitespace;
+
+/**
+ * @brief Resolves a set of ignorable characters.
+ *
+ * @param[out] set The set to initialize.
+ * @param[in] characters NULL-terminated ignorable characters, all below 0x80.
+ * An empty string ignores nothing.
+ * @return baseX_returnType BASEX_OK, or BASEX_ARGUMENTS for a NULL pointer or
+ * a non-ASCII character.
+ */
+baseX_returnType baseX_ignoreInit(baseX_ignoreSet *set, const char *characters);
+
+/**
+ * @brief Returns the number of leading characters which are not ignorable.
+ *
+ * On x86 CPUs with SSE4.1 or AVX2 the characters are checked in blocks of 16
+ * or 32.
+ *
+ * @param[in] srcString Characters to scan.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] set The ignorable characters.
+ * @return size_t Position of the first ignorable character, srcLength if
+ * there is none.
+ */
+size_t baseX_ignoreSpan(const char *srcString,
+                        size_t srcLength,
+                        const baseX_ignoreSet *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASEX_IGNORE_H */
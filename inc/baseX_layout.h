@@ -0,0 +1,108 @@
+/**
+ * @file baseX_layout.h
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Line wrapping and grouping of encoded output, e.g. MIME lines or
+ * colon separated fingerprints.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASEX_LAYOUT_H
+#define BASEX_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "baseX_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Layout of encoded output.
+ *
+ * The separators are only inserted between lines and groups, never at the
+ * start or the end of the output. If both are set, lineLength has to be a
+ * multiple of groupLength and the group separator is replaced by the line
+ * separator at the end of a line.
+ */
+typedef struct {
+  size_t lineLength;          ///< Characters per line, 0 for a single line
+  const char *lineSeparator;  ///< Between the lines, e.g. "\r\n"
+  size_t groupLength;         ///< Characters per group, 0 for no groups
+  const char *groupSeparator; ///< Between the groups of a line, e.g. ":"
+} baseX_layout;
+
+/**
+ * @brief State of a layout while the encoded characters are written.
+ *
+ */
+typedef struct {
+  char *out;                   ///< Next output position
+  size_t unit;                 ///< Characters per group or line, 0 for none
+  size_t column;               ///< Characters in the current unit
+  size_t unitsPerLine;         ///< Units per line, 0 without line breaks
+  size_t units;                ///< Completed units of the current line
+  const char *unitSeparator;   ///< Separator between units of a line
+  size_t unitSeparatorLength;  ///< Length of unitSeparator
+  const char *lineSeparator;   ///< Separator between lines
+  size_t lineSeparatorLength;  ///< Length of lineSeparator
+} baseX_layoutWriter;
+
+/**
+ * @brief Returns the length of characters laid out, without NULL-terminator.
+ *
+ * @param[in] characters Number of encoded characters.
+ * @param[in] layout The layout.
+ * @return size_t Number of characters including the separators, SIZE_MAX if
+ * not representable or if the layout is invalid.
+ */
+size_t baseX_layoutLength(size_t characters, const baseX_layout *layout);
+
+/**
+ * @brief Starts writing laid out characters.
+ *
+ * @param[out] writer State to initialize.
+ * @param[out] out Output buffer, large enough for baseX_layoutLength().
+ * @param[in] layout The layout.
+ * @return baseX_returnType BASEX_OK, or BASEX_ARGUMENTS for a NULL pointer,
+ * a missing separator or a line length which is no multiple of the group
+ * length.
+ */
+baseX_returnType baseX_layoutInit(baseX_layoutWriter *writer,
+                                  char *out,
+                                  const baseX_layout *layout);
+
+/**
+ * @brief Appends encoded characters and the separators between them.
+ *
+ * The characters may be passed in chunks of any length.
+ *
+ * @param[in,out] writer Writer state, writer->out is advanced.
+ * @param[in] chars Encoded characters.
+ * @param[in] count Number of characters.
+ */
+void baseX_layoutWrite(baseX_layoutWriter *writer,
+                       const char *chars,
+                       size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASEX_LAYOUT_H */
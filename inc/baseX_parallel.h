@@ -0,0 +1,107 @@
+/**
+ * @file baseX_parallel.h
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Multithreaded encoding and decoding of large buffers.
+ *
+ * The input is split at group boundaries (3 bytes for base8, 1 byte for
+ * base16, 5 bytes for base32) and every part is converted by its own thread.
+ * The last incomplete group, including the base8 check number and the base32
+ * padding, is converted by the calling thread. The output is the same as the
+ * one of the one-shot functions.
+ *
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BASEX_PARALLEL_H
+#define BASEX_PARALLEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "baseX_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define BASEX_PARALLEL_AUTO (0u) ///< One thread per online processor
+#define BASEX_PARALLEL_MAX_THREADS (256u) ///< Upper limit of the threads
+
+/**
+ * @brief Bases supported by the parallel converters.
+ *
+ */
+typedef enum {
+  BASEX_BASE8,  ///< Same output as base8_encodeBytes() and base8_decodeN()
+  BASEX_BASE16, ///< Same output as base16_encodeBytes() and base16_decodeN()
+  BASEX_BASE32  ///< Same output as base32_encodeBytes() and base32_decodeN()
+} baseX_base;
+
+/**
+ * @brief Encodes the bytes with multiple threads.
+ *
+ * Every thread converts at least 64 KiB, smaller inputs are converted by the
+ * calling thread only. Built with BASEX_NO_THREADS all parts are converted by
+ * the calling thread.
+ *
+ * @param[in] base Base of the output.
+ * @param[out] encodedString Buffer for the NULL-terminated output.
+ * @param[in] encodedSize Size of the output buffer, at least the encoded
+ * length + 1.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @param[in] threads Maximum number of threads, BASEX_PARALLEL_AUTO for one
+ * per online processor.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType baseX_parallelEncode(baseX_base base,
+                                      char *encodedString,
+                                      size_t encodedSize,
+                                      const uint8_t *srcBytes,
+                                      size_t srcLength,
+                                      unsigned int threads);
+
+/**
+ * @brief Decodes the characters with multiple threads.
+ *
+ * The input is split like in baseX_parallelEncode(). Invalid characters are
+ * reported as BASEX_SRCERROR, no matter which thread found them.
+ *
+ * @param[in] base Base of the input.
+ * @param[out] decodedBytes Buffer for the decoded bytes.
+ * @param[out] decodedLength Number of decoded bytes.
+ * @param[in] decodedBytesSize Size of the output buffer in bytes.
+ * @param[in] srcString Encoded input characters.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] threads Maximum number of threads, BASEX_PARALLEL_AUTO for one
+ * per online processor.
+ * @return baseX_returnType Status code.
+ */
+baseX_returnType baseX_parallelDecode(baseX_base base,
+                                      uint8_t *decodedBytes,
+                                      size_t *decodedLength,
+                                      size_t decodedBytesSize,
+                                      const char *srcString,
+                                      size_t srcLength,
+                                      unsigned int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASEX_PARALLEL_H */
@@ -29,6 +29,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -45,6 +46,15 @@ typedef enum {
 
 #define BASEX_BYTE_BIT_LENGTH (8) ///< Byte bit length
 
+/**
+ * @brief One input of a batch conversion
+ *
+ */
+typedef struct {
+  const void *data; ///< Input bytes (encode) or characters (decode)
+  size_t length;    ///< Number of input bytes or characters
+} baseX_batchItem;
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,11 +22,127 @@
  */
 
 #include "base16_converter.h"
+#include "baseX_cpu.h"
 
 #include <stdio.h>
 #include <string.h>
 
+#ifdef BASEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
 #define BASE16_CHAR_PER_BYTE (2)
+#define BASE16_BATCH_STAGE (4096) ///< Gathered bytes of short batch items
+#define BASE16_LAYOUT_STAGE (2048) ///< Bytes encoded per layout step
+
+// Character of the nibble v, letters starting at a
+#define BASE16_DIGIT(v, a) ((char)((v) < 10 ? '0' + (v) : (a) + (v) - 10))
+#define BASE16_PAIR(b, a)                                                      \
+  {BASE16_DIGIT((b) >> 4, a), BASE16_DIGIT((b) & 0xF, a)}
+#define BASE16_ROW(h, a)                                                       \
+  BASE16_PAIR(h + 0x0, a), BASE16_PAIR(h + 0x1, a), BASE16_PAIR(h + 0x2, a),   \
+      BASE16_PAIR(h + 0x3, a), BASE16_PAIR(h + 0x4, a),                        \
+      BASE16_PAIR(h + 0x5, a), BASE16_PAIR(h + 0x6, a),                        \
+      BASE16_PAIR(h + 0x7, a), BASE16_PAIR(h + 0x8, a),                        \
+      BASE16_PAIR(h + 0x9, a), BASE16_PAIR(h + 0xA, a),                        \
+      BASE16_PAIR(h + 0xB, a), BASE16_PAIR(h + 0xC, a),                        \
+      BASE16_PAIR(h + 0xD, a), BASE16_PAIR(h + 0xE, a), BASE16_PAIR(h + 0xF, a)
+#define BASE16_ALPHABET(a)                                                     \
+  {.pairs = {BASE16_ROW(0x00, a), BASE16_ROW(0x10, a), BASE16_ROW(0x20, a),    \
+             BASE16_ROW(0x30, a), BASE16_ROW(0x40, a), BASE16_ROW(0x50, a),    \
+             BASE16_ROW(0x60, a), BASE16_ROW(0x70, a), BASE16_ROW(0x80, a),    \
+             BASE16_ROW(0x90, a), BASE16_ROW(0xA0, a), BASE16_ROW(0xB0, a),    \
+             BASE16_ROW(0xC0, a), BASE16_ROW(0xD0, a), BASE16_ROW(0xE0, a),    \
+             BASE16_ROW(0xF0, a)},                                             \
+   .digits = {BASE16_DIGIT(0x0, a), BASE16_DIGIT(0x1, a),                    \
+              BASE16_DIGIT(0x2, a), BASE16_DIGIT(0x3, a),                    \
+              BASE16_DIGIT(0x4, a), BASE16_DIGIT(0x5, a),                    \
+              BASE16_DIGIT(0x6, a), BASE16_DIGIT(0x7, a),                    \
+              BASE16_DIGIT(0x8, a), BASE16_DIGIT(0x9, a),                    \
+              BASE16_DIGIT(0xA, a), BASE16_DIGIT(0xB, a),                    \
+              BASE16_DIGIT(0xC, a), BASE16_DIGIT(0xD, a),                    \
+              BASE16_DIGIT(0xE, a), BASE16_DIGIT(0xF, a)}}
+
+const base16_alphabet base16_upperAlphabet = BASE16_ALPHABET('A');
+const base16_alphabet base16_lowerAlphabet = BASE16_ALPHABET('a');
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Encodes the bytes in blocks of 16 with SSE4.1.
+ *
+ * @param[out] encodedString Output buffer, 2 characters per processed byte.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @return size_t Number of processed bytes (a multiple of 16).
+ */
+static size_t base16_encodeSSE41(char *encodedString,
+                                 const uint8_t *srcBytes,
+                                 size_t srcLength,
+                                 const char *digits);
+
+/**
+ * @brief Encodes the bytes in blocks of 32 with AVX2.
+ *
+ * @param[out] encodedString Output buffer, 2 characters per processed byte.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @return size_t Number of processed bytes (a multiple of 32).
+ */
+static size_t base16_encodeAVX2(char *encodedString,
+                                const uint8_t *srcBytes,
+                                size_t srcLength,
+                                const char *digits);
+
+/**
+ * @brief Decodes the characters in blocks of 32 with SSE4.1.
+ *
+ * Stops at the first block containing an invalid character, which is then
+ * reported by the scalar loop.
+ *
+ * @param[out] decodedBytes Output buffer, 1 byte per 2 processed characters.
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Number of processed characters (a multiple of 32).
+ */
+static size_t base16_decodeSSE41(uint8_t *decodedBytes,
+                                 const char *srcString,
+                                 size_t srcLength);
+
+/**
+ * @brief Decodes the characters in blocks of 64 with AVX2.
+ *
+ * Stops at the first block containing an invalid character, which is then
+ * reported by the scalar loop.
+ *
+ * @param[out] decodedBytes Output buffer, 1 byte per 2 processed characters.
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Number of processed characters (a multiple of 64).
+ */
+static size_t base16_decodeAVX2(uint8_t *decodedBytes,
+                                const char *srcString,
+                                size_t srcLength);
+
+/**
+ * @brief Checks the characters in blocks of 16 with SSE4.1.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Position of the first invalid character, or the number of
+ * checked characters (a multiple of 16) if there is none.
+ */
+static size_t base16_validateSSE41(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Checks the characters in blocks of 32 with AVX2.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Position of the first invalid character, or the number of
+ * checked characters (a multiple of 32) if there is none.
+ */
+static size_t base16_validateAVX2(const char *srcString, size_t srcLength);
+#endif
 
 /**
  * @brief Returns the decimal number of the hexadecimal character.
@@ -38,57 +154,609 @@
  */
 int8_t hexCharToInt(char c);
 
+/**
+ * @brief Returns the value of the hexadecimal character without branches or
+ * table lookups.
+ *
+ * @param[in] c The character to convert.
+ * @param[in,out] invalid Set to all ones if c is no hexadecimal character.
+ * @return uint32_t The value of the character, 0 if it is invalid.
+ */
+static inline uint32_t base16_constantTimeValue(uint32_t c,
+                                                uint32_t *invalid);
+
+/**
+ * @brief Encodes the bytes without any checks and without NULL-terminator.
+ *
+ * @param[out] encodedString Output buffer, 2 characters per byte.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ */
+static void base16_encodeBlock(char *encodedString,
+                               const uint8_t *srcBytes,
+                               size_t srcLength,
+                               const base16_alphabet *alphabet);
+
+/**
+ * @brief Decodes an even number of characters without argument checks.
+ *
+ * @param[out] decodedBytes Output buffer, 1 byte per 2 characters.
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters, a multiple of 2.
+ * @return baseX_returnType BASEX_OK or BASEX_SRCERROR.
+ */
+static baseX_returnType base16_decodeBlock(uint8_t *decodedBytes,
+                                           const char *srcString,
+                                           size_t srcLength);
+
+/**
+ * @brief Decodes gathered batch items and searches the failed item on an
+ * error.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] offsets Output offsets of the items.
+ * @param[in] items All batch items.
+ * @param[in] first Index of the first gathered item.
+ * @param[in] end Index after the last gathered item.
+ * @param[in] gathered Concatenated characters of the gathered items.
+ * @param[in] gatheredLength Number of gathered characters.
+ * @param[out] errorItem Index of the failed item, may be NULL.
+ * @return baseX_returnType BASEX_OK or BASEX_SRCERROR.
+ */
+static baseX_returnType base16_decodeGathered(uint8_t *arena,
+                                              const size_t *offsets,
+                                              const baseX_batchItem *items,
+                                              size_t first,
+                                              size_t end,
+                                              const char *gathered,
+                                              size_t gatheredLength,
+                                              size_t *errorItem);
+
 baseX_returnType base16_decodeString(uint8_t *decodedBytes,
-                                     uint32_t *decodedLength,
-                                     uint32_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
                                      const char *srcString)
+{
+  if (!srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  return base16_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                        srcString, strlen(srcString));
+}
+
+baseX_returnType base16_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength)
 {
   if (!decodedBytes || !decodedLength || !srcString) {
     return BASEX_ARGUMENTS;
   }
-  uint32_t srcLength = (uint32_t)strlen(srcString);
   if (0 == srcLength || (srcLength % BASE16_CHAR_PER_BYTE)) {
     return BASEX_SRCERROR;
   }
-  *decodedLength = srcLength / BASE16_CHAR_PER_BYTE;
-  if (*decodedLength > decodedBytesSize) {
+  size_t outputLength = srcLength / BASE16_CHAR_PER_BYTE;
+  *decodedLength = outputLength;
+  if (outputLength > decodedBytesSize) {
     return BASEX_OVERFLOW;
   }
 
-  for (uint32_t i = 0; i < srcLength;) {
-    int8_t high = hexCharToInt(srcString[i++]);
-    int8_t low = hexCharToInt(srcString[i++]);
-    if (high == -1 || low == -1) {
-      return BASEX_SRCERROR; // Src error, not allowed character letter
+  return base16_decodeBlock(decodedBytes, srcString, srcLength);
+}
+
+baseX_returnType base16_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength)
+{
+  if (!buffer) {
+    return BASEX_ARGUMENTS;
+  }
+  // The kernels store 16 bytes below the 32 characters they loaded
+  return base16_decodeN((uint8_t *)buffer, decodedLength, length, buffer,
+                        length);
+}
+
+baseX_returnType base16_decodeIgnore(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     size_t srcLength,
+                                     const baseX_ignoreSet *ignore)
+{
+  if (!decodedBytes || !decodedLength || !srcString || !ignore) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t run = baseX_ignoreSpan(srcString, srcLength, ignore);
+  if (run == srcLength) {
+    return base16_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                          srcString, srcLength);
+  }
+
+  base16_decodeContext ctx;
+  base16_decodeInit(&ctx);
+  size_t wPos = 0;
+  size_t rPos = 0;
+  for (;;) {
+    size_t written = 0;
+    baseX_returnType ret =
+        base16_decodeUpdate(&ctx, decodedBytes + wPos, decodedBytesSize - wPos,
+                            &written, srcString + rPos, run);
+    if (BASEX_OK != ret) {
+      return ret;
     }
-    *decodedBytes++ = (uint8_t)((high << 4) | low);
+    wPos += written;
+    rPos += run;
+    while (rPos < srcLength && ignore->characters[(uint8_t)srcString[rPos]]) {
+      rPos++;
+    }
+    if (rPos == srcLength) {
+      break;
+    }
+    run = baseX_ignoreSpan(srcString + rPos, srcLength - rPos, ignore);
   }
-  return BASEX_OK; // success
+  size_t written = 0;
+  baseX_returnType ret = base16_decodeFinal(
+      &ctx, decodedBytes + wPos, decodedBytesSize - wPos, &written);
+  *decodedLength = wPos + written;
+  return ret;
+}
+
+baseX_returnType base16_validate(const char *srcString,
+                                 size_t srcLength,
+                                 size_t *errorOffset)
+{
+  if (!srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    i = base16_validateAVX2(srcString, srcLength);
+  } else if (features & BASEX_CPU_SSE41) {
+    i = base16_validateSSE41(srcString, srcLength);
+  }
+#endif
+  for (; i < srcLength; i++) {
+    if (-1 == hexCharToInt(srcString[i])) {
+      break;
+    }
+  }
+  // A wrong length is reported behind the last character
+  if (i == srcLength && srcLength && !(srcLength % BASE16_CHAR_PER_BYTE)) {
+    return BASEX_OK;
+  }
+  if (errorOffset) {
+    *errorOffset = i;
+  }
+  return BASEX_SRCERROR;
+}
+
+baseX_returnType base16_decodeConstantTime(uint8_t *decodedBytes,
+                                           size_t *decodedLength,
+                                           size_t decodedBytesSize,
+                                           const char *srcString,
+                                           size_t srcLength)
+{
+  if (!decodedBytes || !decodedLength || !srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  if (0 == srcLength || (srcLength % BASE16_CHAR_PER_BYTE)) {
+    return BASEX_SRCERROR;
+  }
+  size_t outputLength = srcLength / BASE16_CHAR_PER_BYTE;
+  *decodedLength = outputLength;
+  if (outputLength > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  // Invalid characters are collected and only reported after the last one
+  const uint8_t *src = (const uint8_t *)srcString;
+  uint32_t invalid = 0;
+  for (size_t i = 0; i < outputLength; i++) {
+    uint32_t high = base16_constantTimeValue(src[2 * i], &invalid);
+    uint32_t low = base16_constantTimeValue(src[2 * i + 1], &invalid);
+    decodedBytes[i] = (uint8_t)((high << 4) | low);
+  }
+  return invalid ? BASEX_SRCERROR : BASEX_OK;
 }
 
 baseX_returnType base16_encodeBytes(char *encodedString,
-                                    uint32_t encodedSize,
+                                    size_t encodedSize,
                                     const uint8_t *srcBytes,
-                                    uint32_t srcLength)
+                                    size_t srcLength)
 {
   if (!encodedString || !srcBytes) {
     return BASEX_ARGUMENTS;
   }
 
-  uint32_t outputLength = srcLength * BASE16_CHAR_PER_BYTE;
-  if (encodedSize < (outputLength + 1)) { // +1 for null terminator
+  size_t outputLength = base16_encodedLength(srcLength);
+  if (outputLength >= encodedSize) { // +1 for null terminator
     return BASEX_OVERFLOW;
   }
-  const char hexDigits[16] = "0123456789ABCDEF";
-  for (uint32_t i = 0; i < srcLength; i++) {
-    uint8_t c = srcBytes[i];
-    *encodedString++ = hexDigits[(c >> 4) & 0xF];
-    *encodedString++ = hexDigits[c & 0xF];
+  base16_encodeBlock(encodedString, srcBytes, srcLength,
+                     &base16_upperAlphabet);
+  encodedString[outputLength] = '\0';
+  return BASEX_OK;
+}
+
+baseX_returnType base16_encodeBytesAlphabet(char *encodedString,
+                                            size_t encodedSize,
+                                            const uint8_t *srcBytes,
+                                            size_t srcLength,
+                                            const base16_alphabet *alphabet)
+{
+  if (!encodedString || !srcBytes || !alphabet) {
+    return BASEX_ARGUMENTS;
+  }
+
+  size_t outputLength = base16_encodedLength(srcLength);
+  if (outputLength >= encodedSize) { // +1 for null terminator
+    return BASEX_OVERFLOW;
   }
-  *encodedString = '\0';
+  base16_encodeBlock(encodedString, srcBytes, srcLength, alphabet);
+  encodedString[outputLength] = '\0';
   return BASEX_OK;
 }
 
+baseX_returnType base16_encodeBytesLayout(char *encodedString,
+                                          size_t encodedSize,
+                                          const uint8_t *srcBytes,
+                                          size_t srcLength,
+                                          const base16_alphabet *alphabet,
+                                          const baseX_layout *layout)
+{
+  baseX_layoutWriter writer;
+  if (!srcBytes || !alphabet ||
+      BASEX_OK != baseX_layoutInit(&writer, encodedString, layout)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t outputLength = base16_encodedLengthLayout(srcLength, layout);
+  if (outputLength >= encodedSize) { // +1 for null terminator
+    return BASEX_OVERFLOW;
+  }
+
+  // Encode in steps which stay in the L1 cache and lay them out
+  char stage[BASE16_CHAR_PER_BYTE * BASE16_LAYOUT_STAGE];
+  for (size_t i = 0; i < srcLength; i += BASE16_LAYOUT_STAGE) {
+    size_t n = srcLength - i;
+    if (n > BASE16_LAYOUT_STAGE) {
+      n = BASE16_LAYOUT_STAGE;
+    }
+    base16_encodeBlock(stage, srcBytes + i, n, alphabet);
+    baseX_layoutWrite(&writer, stage, n * BASE16_CHAR_PER_BYTE);
+  }
+  encodedString[outputLength] = '\0';
+  return BASEX_OK;
+}
+
+baseX_returnType base16_alphabetInit(base16_alphabet *alphabet,
+                                     const char *digits)
+{
+  if (!alphabet || !digits) {
+    return BASEX_ARGUMENTS;
+  }
+  for (uint8_t i = 0; i < sizeof(alphabet->digits); i++) {
+    if (!digits[i] || memchr(digits, digits[i], i)) {
+      return BASEX_ARGUMENTS; // Not decodable or not printable as string
+    }
+  }
+  memcpy(alphabet->digits, digits, sizeof(alphabet->digits));
+  for (size_t b = 0; b < 256; b++) {
+    alphabet->pairs[b][0] = digits[b >> 4];
+    alphabet->pairs[b][1] = digits[b & 0xF];
+  }
+  return BASEX_OK;
+}
+
+size_t base16_encodedLengthLayout(size_t srcLength,
+                                  const baseX_layout *layout)
+{
+  size_t length = base16_encodedLength(srcLength);
+  if (SIZE_MAX == length) {
+    return SIZE_MAX;
+  }
+  return baseX_layoutLength(length, layout);
+}
+
+size_t base16_encodedLength(size_t srcLength)
+{
+  if (srcLength > SIZE_MAX / BASE16_CHAR_PER_BYTE) {
+    return SIZE_MAX; // Output length not representable
+  }
+  return BASE16_ENCODED_LENGTH(srcLength);
+}
+
+size_t base16_maxDecodedLength(size_t srcLength)
+{
+  return BASE16_MAX_DECODED_LENGTH(srcLength);
+}
+
+size_t base16_decodedLength(const char *srcString, size_t srcLength)
+{
+  (void)srcString;
+  return BASE16_MAX_DECODED_LENGTH(srcLength);
+}
+
+baseX_returnType base16_encodeInit(base16_encodeContext *ctx)
+{
+  if (!ctx) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
+
+baseX_returnType base16_encodeUpdate(base16_encodeContext *ctx,
+                                     char *encodedString,
+                                     size_t encodedSize,
+                                     size_t *encodedLength,
+                                     const uint8_t *srcBytes,
+                                     size_t srcLength)
+{
+  if (!ctx || !encodedString || !encodedLength || (!srcBytes && srcLength)) {
+    return BASEX_ARGUMENTS;
+  }
+  if (srcLength > encodedSize / BASE16_CHAR_PER_BYTE) {
+    return BASEX_OVERFLOW;
+  }
+  base16_encodeBlock(encodedString, srcBytes, srcLength,
+                     &base16_upperAlphabet);
+  *encodedLength = srcLength * BASE16_CHAR_PER_BYTE;
+  return BASEX_OK;
+}
+
+baseX_returnType base16_encodeFinal(base16_encodeContext *ctx,
+                                    char *encodedString,
+                                    size_t encodedSize,
+                                    size_t *encodedLength)
+{
+  (void)encodedSize; // Base16 has no incomplete groups
+  if (!ctx || !encodedString || !encodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  *encodedLength = 0;
+  return BASEX_OK;
+}
+
+baseX_returnType base16_decodeInit(base16_decodeContext *ctx)
+{
+  if (!ctx) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
+
+baseX_returnType base16_decodeUpdate(base16_decodeContext *ctx,
+                                     uint8_t *decodedBytes,
+                                     size_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     const char *srcString,
+                                     size_t srcLength)
+{
+  if (!ctx || !decodedBytes || !decodedLength || (!srcString && srcLength)) {
+    return BASEX_ARGUMENTS;
+  }
+  if ((ctx->pending + srcLength) / BASE16_CHAR_PER_BYTE > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+  *decodedLength = 0;
+  if (0 == srcLength) {
+    return BASEX_OK;
+  }
+  ctx->started = 1;
+
+  size_t outPos = 0;
+  if (ctx->pending) {
+    // Complete the byte with the pending high nibble
+    int8_t low = hexCharToInt(*srcString++);
+    srcLength--;
+    if (-1 == low) {
+      return BASEX_SRCERROR;
+    }
+    decodedBytes[outPos++] = (uint8_t)((ctx->high << 4) | low);
+    ctx->pending = 0;
+  }
+
+  size_t blockLength = srcLength - (srcLength % BASE16_CHAR_PER_BYTE);
+  if (BASEX_OK != base16_decodeBlock(decodedBytes + outPos, srcString,
+                                     blockLength)) {
+    return BASEX_SRCERROR;
+  }
+  outPos += blockLength / BASE16_CHAR_PER_BYTE;
+
+  if (blockLength < srcLength) {
+    int8_t high = hexCharToInt(srcString[blockLength]);
+    if (-1 == high) {
+      return BASEX_SRCERROR;
+    }
+    ctx->high = (uint8_t)high;
+    ctx->pending = 1;
+  }
+  *decodedLength = outPos;
+  return BASEX_OK;
+}
+
+baseX_returnType base16_decodeFinal(base16_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength)
+{
+  (void)decodedBytesSize; // Base16 has no incomplete groups
+  if (!ctx || !decodedBytes || !decodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  *decodedLength = 0;
+  if (!ctx->started || ctx->pending) {
+    return BASEX_SRCERROR;
+  }
+  return BASEX_OK;
+}
+
+baseX_returnType base16_encodeBatch(char *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count)
+{
+  if (!arena || !offsets || (!items && count)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!items[i].data && items[i].length) {
+      return BASEX_ARGUMENTS;
+    }
+    size_t length = base16_encodedLength(items[i].length);
+    if (length > SIZE_MAX - total) {
+      return BASEX_OVERFLOW; // Output length not representable
+    }
+    offsets[i] = total;
+    total += length;
+  }
+  offsets[count] = total;
+  if (total > arenaSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  // The encoding of concatenated bytes is the concatenated encoding, so
+  // short items are gathered and encoded together by the vectorized kernels
+  uint8_t stage[BASE16_BATCH_STAGE];
+  size_t staged = 0;
+  char *out = arena;
+  for (size_t i = 0; i < count; i++) {
+    size_t length = items[i].length;
+    if (staged + length > BASE16_BATCH_STAGE ||
+        length > BASE16_BATCH_STAGE / 2) {
+      base16_encodeBlock(out, stage, staged, &base16_upperAlphabet);
+      out += staged * BASE16_CHAR_PER_BYTE;
+      staged = 0;
+    }
+    if (length > BASE16_BATCH_STAGE / 2) {
+      base16_encodeBlock(out, items[i].data, length,
+                         &base16_upperAlphabet);
+      out += length * BASE16_CHAR_PER_BYTE;
+    } else if (length) {
+      memcpy(stage + staged, items[i].data, length);
+      staged += length;
+    }
+  }
+  base16_encodeBlock(out, stage, staged, &base16_upperAlphabet);
+  return BASEX_OK;
+}
+
+baseX_returnType base16_decodeBatch(uint8_t *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count,
+                                    size_t *errorItem)
+{
+  if (!arena || !offsets || (!items && count)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!items[i].data) {
+      return BASEX_ARGUMENTS;
+    }
+    if (0 == items[i].length || (items[i].length % BASE16_CHAR_PER_BYTE)) {
+      if (errorItem) {
+        *errorItem = i;
+      }
+      return BASEX_SRCERROR;
+    }
+    offsets[i] = total;
+    total += items[i].length / BASE16_CHAR_PER_BYTE;
+  }
+  offsets[count] = total;
+  if (total > arenaSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  // Gather short items like base16_encodeBatch()
+  char stage[BASE16_BATCH_STAGE];
+  size_t staged = 0;
+  size_t stageFirst = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t length = items[i].length;
+    if (staged + length > BASE16_BATCH_STAGE ||
+        length > BASE16_BATCH_STAGE / 2) {
+      if (BASEX_OK != base16_decodeGathered(arena, offsets, items, stageFirst,
+                                            i, stage, staged, errorItem)) {
+        return BASEX_SRCERROR;
+      }
+      staged = 0;
+    }
+    if (length > BASE16_BATCH_STAGE / 2) {
+      if (BASEX_OK != base16_decodeGathered(arena, offsets, items, i, i + 1,
+                                            items[i].data, length,
+                                            errorItem)) {
+        return BASEX_SRCERROR;
+      }
+      continue;
+    }
+    if (0 == staged) {
+      stageFirst = i;
+    }
+    memcpy(stage + staged, items[i].data, length);
+    staged += length;
+  }
+  return base16_decodeGathered(arena, offsets, items, stageFirst, count, stage,
+                               staged, errorItem);
+}
+
+static void base16_encodeBlock(char *encodedString,
+                               const uint8_t *srcBytes,
+                               size_t srcLength,
+                               const base16_alphabet *alphabet)
+{
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    i = base16_encodeAVX2(encodedString, srcBytes, srcLength,
+                          alphabet->digits);
+  } else if (features & BASEX_CPU_SSE41) {
+    i = base16_encodeSSE41(encodedString, srcBytes, srcLength,
+                           alphabet->digits);
+  }
+#endif
+  // One 16 bit load and store per byte
+  for (; i < srcLength; i++) {
+    memcpy(encodedString + i * BASE16_CHAR_PER_BYTE,
+           alphabet->pairs[srcBytes[i]], BASE16_CHAR_PER_BYTE);
+  }
+}
+
+static baseX_returnType base16_decodeBlock(uint8_t *decodedBytes,
+                                           const char *srcString,
+                                           size_t srcLength)
+{
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    i = base16_decodeAVX2(decodedBytes, srcString, srcLength);
+  } else if (features & BASEX_CPU_SSE41) {
+    i = base16_decodeSSE41(decodedBytes, srcString, srcLength);
+  }
+  decodedBytes += i / BASE16_CHAR_PER_BYTE;
+#endif
+
+  while (i < srcLength) {
+    int8_t high = hexCharToInt(srcString[i++]);
+    int8_t low = hexCharToInt(srcString[i++]);
+    if (high == -1 || low == -1) {
+      return BASEX_SRCERROR; // Src error, not allowed character letter
+    }
+    *decodedBytes++ = (uint8_t)((high << 4) | low);
+  }
+  return BASEX_OK; // success
+}
+
 int8_t hexCharToInt(char c)
 {
   if ('0' <= c && c <= '9') {
@@ -101,4 +769,232 @@ int8_t hexCharToInt(char c)
     return c - 'a' + 10;
   }
   return -1; // invalid character
-}
\ No newline at end of file
+}
+
+static inline uint32_t base16_constantTimeValue(uint32_t c,
+                                                uint32_t *invalid)
+{
+  // All ones if low <= c <= high: both differences are negative
+#define BASE16_RANGE(low, high)                                               \
+  (0u - ((((uint32_t)(low) - 1u - c) & (c - (uint32_t)(high) - 1u)) >> 31))
+  uint32_t digit = BASE16_RANGE('0', '9');
+  uint32_t upper = BASE16_RANGE('A', 'F');
+  uint32_t lower = BASE16_RANGE('a', 'f');
+#undef BASE16_RANGE
+  *invalid |= ~(digit | upper | lower);
+  return (digit & (c - '0')) | (upper & (c - 'A' + 10)) |
+         (lower & (c - 'a' + 10));
+}
+
+#ifdef BASEX_X86_SIMD
+__attribute__((target("sse4.1"))) static size_t
+base16_encodeSSE41(char *encodedString,
+                   const uint8_t *srcBytes,
+                   size_t srcLength,
+                   const char *digits)
+{
+  const __m128i lookup = _mm_loadu_si128((const __m128i *)digits);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= srcLength; i += 16) {
+    __m128i in = _mm_loadu_si128((const __m128i *)(srcBytes + i));
+    __m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+    __m128i low = _mm_and_si128(in, nibble);
+    high = _mm_shuffle_epi8(lookup, high);
+    low = _mm_shuffle_epi8(lookup, low);
+    _mm_storeu_si128((__m128i *)(encodedString + 2 * i),
+                     _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i *)(encodedString + 2 * i + 16),
+                     _mm_unpackhi_epi8(high, low));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+base16_encodeAVX2(char *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t srcLength,
+                  const char *digits)
+{
+  const __m256i lookup =
+      _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)digits));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m256i in = _mm256_loadu_si256((const __m256i *)(srcBytes + i));
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble);
+    __m256i low = _mm256_and_si256(in, nibble);
+    high = _mm256_shuffle_epi8(lookup, high);
+    low = _mm256_shuffle_epi8(lookup, low);
+    // Unpacking works per 128 bit lane, reorder the lanes afterwards
+    __m256i first = _mm256_unpacklo_epi8(high, low);
+    __m256i second = _mm256_unpackhi_epi8(high, low);
+    _mm256_storeu_si256((__m256i *)(encodedString + 2 * i),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256((__m256i *)(encodedString + 2 * i + 32),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+  }
+  return i;
+}
+
+/**
+ * @brief Converts 16 hexadecimal characters into their nibble values.
+ *
+ * @param[in] in The characters to convert.
+ * @param[out] valid Set to 0xFF for every valid character.
+ * @return __m128i The nibble values of the valid characters.
+ */
+__attribute__((target("sse4.1"))) static inline __m128i
+base16_nibblesSSE41(__m128i in, __m128i *valid)
+{
+  // Setting bit 5 folds 'A'-'F' onto 'a'-'f' and keeps the digits unchanged
+  __m128i folded = _mm_or_si128(in, _mm_set1_epi8(0x20));
+  __m128i digit =
+      _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8('0')), in),
+                    _mm_cmpeq_epi8(_mm_min_epu8(in, _mm_set1_epi8('9')), in));
+  __m128i letter = _mm_and_si128(
+      _mm_cmpeq_epi8(_mm_max_epu8(folded, _mm_set1_epi8('a')), folded),
+      _mm_cmpeq_epi8(_mm_min_epu8(folded, _mm_set1_epi8('f')), folded));
+  *valid = _mm_or_si128(digit, letter);
+  return _mm_blendv_epi8(_mm_sub_epi8(folded, _mm_set1_epi8('a' - 10)),
+                         _mm_sub_epi8(in, _mm_set1_epi8('0')), digit);
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base16_decodeSSE41(uint8_t *decodedBytes,
+                   const char *srcString,
+                   size_t srcLength)
+{
+  const __m128i weights = _mm_set1_epi16(0x0110); // high * 16 + low
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m128i validFirst;
+    __m128i validSecond;
+    __m128i first = base16_nibblesSSE41(
+        _mm_loadu_si128((const __m128i *)(srcString + i)), &validFirst);
+    __m128i second = base16_nibblesSSE41(
+        _mm_loadu_si128((const __m128i *)(srcString + i + 16)), &validSecond);
+    if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(validFirst, validSecond))) {
+      break;
+    }
+    first = _mm_maddubs_epi16(first, weights);
+    second = _mm_maddubs_epi16(second, weights);
+    _mm_storeu_si128((__m128i *)(decodedBytes + i / BASE16_CHAR_PER_BYTE),
+                     _mm_packus_epi16(first, second));
+  }
+  return i;
+}
+
+/**
+ * @brief Converts 32 hexadecimal characters into their nibble values.
+ *
+ * @param[in] in The characters to convert.
+ * @param[out] valid Set to 0xFF for every valid character.
+ * @return __m256i The nibble values of the valid characters.
+ */
+__attribute__((target("avx2"))) static inline __m256i
+base16_nibblesAVX2(__m256i in, __m256i *valid)
+{
+  // Setting bit 5 folds 'A'-'F' onto 'a'-'f' and keeps the digits unchanged
+  __m256i folded = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+  __m256i digit = _mm256_and_si256(
+      _mm256_cmpeq_epi8(_mm256_max_epu8(in, _mm256_set1_epi8('0')), in),
+      _mm256_cmpeq_epi8(_mm256_min_epu8(in, _mm256_set1_epi8('9')), in));
+  __m256i letter = _mm256_and_si256(
+      _mm256_cmpeq_epi8(_mm256_max_epu8(folded, _mm256_set1_epi8('a')),
+                        folded),
+      _mm256_cmpeq_epi8(_mm256_min_epu8(folded, _mm256_set1_epi8('f')),
+                        folded));
+  *valid = _mm256_or_si256(digit, letter);
+  return _mm256_blendv_epi8(
+      _mm256_sub_epi8(folded, _mm256_set1_epi8('a' - 10)),
+      _mm256_sub_epi8(in, _mm256_set1_epi8('0')), digit);
+}
+
+__attribute__((target("avx2"))) static size_t
+base16_decodeAVX2(uint8_t *decodedBytes,
+                  const char *srcString,
+                  size_t srcLength)
+{
+  const __m256i weights = _mm256_set1_epi16(0x0110); // high * 16 + low
+  size_t i = 0;
+  for (; i + 64 <= srcLength; i += 64) {
+    __m256i validFirst;
+    __m256i validSecond;
+    __m256i first = base16_nibblesAVX2(
+        _mm256_loadu_si256((const __m256i *)(srcString + i)), &validFirst);
+    __m256i second = base16_nibblesAVX2(
+        _mm256_loadu_si256((const __m256i *)(srcString + i + 32)),
+        &validSecond);
+    if (-1 != _mm256_movemask_epi8(_mm256_and_si256(validFirst, validSecond))) {
+      break;
+    }
+    first = _mm256_maddubs_epi16(first, weights);
+    second = _mm256_maddubs_epi16(second, weights);
+    // Packing works per 128 bit lane, reorder the 64 bit blocks afterwards
+    __m256i packed = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(first, second), 0xD8);
+    _mm256_storeu_si256((__m256i *)(decodedBytes + i / BASE16_CHAR_PER_BYTE),
+                        packed);
+  }
+  return i;
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base16_validateSSE41(const char *srcString, size_t srcLength)
+{
+  size_t i = 0;
+  for (; i + 16 <= srcLength; i += 16) {
+    __m128i valid;
+    base16_nibblesSSE41(_mm_loadu_si128((const __m128i *)(srcString + i)),
+                        &valid);
+    int invalid = 0xFFFF ^ _mm_movemask_epi8(valid);
+    if (invalid) {
+      return i + (size_t)__builtin_ctz((unsigned)invalid);
+    }
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+base16_validateAVX2(const char *srcString, size_t srcLength)
+{
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m256i valid;
+    base16_nibblesAVX2(_mm256_loadu_si256((const __m256i *)(srcString + i)),
+                       &valid);
+    unsigned invalid = ~(unsigned)_mm256_movemask_epi8(valid);
+    if (invalid) {
+      return i + (size_t)__builtin_ctz(invalid);
+    }
+  }
+  return i;
+}
+#endif
+
+static baseX_returnType base16_decodeGathered(uint8_t *arena,
+                                              const size_t *offsets,
+                                              const baseX_batchItem *items,
+                                              size_t first,
+                                              size_t end,
+                                              const char *gathered,
+                                              size_t gatheredLength,
+                                              size_t *errorItem)
+{
+  if (0 == gatheredLength ||
+      BASEX_OK == base16_decodeBlock(arena + offsets[first], gathered,
+                                     gatheredLength)) {
+    return BASEX_OK;
+  }
+  for (size_t i = first; i < end; i++) {
+    if (BASEX_OK != base16_decodeBlock(arena + offsets[i], items[i].data,
+                                       items[i].length)) {
+      if (errorItem) {
+        *errorItem = i;
+      }
+      break;
+    }
+  }
+  return BASEX_SRCERROR;
+}
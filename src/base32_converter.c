@@ -22,14 +22,139 @@
  */
 
 #include "base32_converter.h"
+#include "baseX_cpu.h"
 
-#include <ctype.h>
 #include <string.h>
 
+#ifdef BASEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define BASE32_LAYOUT_STAGE (2560) ///< Bytes encoded per layout step
+#define BASE32_BATCH_STAGE (2560) ///< Gathered groups of short batch items
+#define BASE32_VALUE_MASK (0x1F1F1F1F1F1F1F1Full) ///< 5 bit value per byte
+#define BASE32_VBMI_BLOCK_MASK (0xFFFFFFFFFFull) ///< 40 bytes of 8 groups
+
 const char paddingCharacter = '='; ///< Padding character
-static const char *base32_alphabet =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"; ///< used base32 characters listed as an
-                                        ///< alphabet
+
+#ifdef BASEX_X86_SIMD
+/// Byte j < 5 of qword k takes input byte 5k + 4 - j, the group little endian
+#define BASE32_VBMI_LOAD(k)                                                    \
+  5 * (k) + 4, 5 * (k) + 3, 5 * (k) + 2, 5 * (k) + 1, 5 * (k), 0, 0, 0
+
+/// Output byte 5k + j takes byte 4 - j of qword k
+#define BASE32_VBMI_STORE(k)                                                   \
+  8 * (k) + 4, 8 * (k) + 3, 8 * (k) + 2, 8 * (k) + 1, 8 * (k)
+
+/// Big endian 16 bit words holding the 8 values of the group at byte o
+#define BASE32_AVX2_WORDS(o)                                                   \
+  (o) + 1, (o), (o) + 1, (o), (o) + 2, (o) + 1, (o) + 2, (o) + 1, (o) + 3,     \
+      (o) + 2, (o) + 4, (o) + 3, (o) + 4, (o) + 3, -1, (o) + 4
+
+static const uint8_t base32_vbmiLoad[64] = {
+    BASE32_VBMI_LOAD(0), BASE32_VBMI_LOAD(1), BASE32_VBMI_LOAD(2),
+    BASE32_VBMI_LOAD(3), BASE32_VBMI_LOAD(4), BASE32_VBMI_LOAD(5),
+    BASE32_VBMI_LOAD(6), BASE32_VBMI_LOAD(7)};
+
+static const uint8_t base32_vbmiStore[64] = {
+    BASE32_VBMI_STORE(0), BASE32_VBMI_STORE(1), BASE32_VBMI_STORE(2),
+    BASE32_VBMI_STORE(3), BASE32_VBMI_STORE(4), BASE32_VBMI_STORE(5),
+    BASE32_VBMI_STORE(6), BASE32_VBMI_STORE(7)};
+#endif
+
+/*
+ * Prebuilt alphabets. Lowercase letters decode like uppercase ones as long
+ * as they are not part of the alphabet themselves.
+ */
+#define IV BASE32_INVALID
+const base32_alphabet base32_rfcAlphabet = {
+    .characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567",
+    .padding = '=',
+    .reverse = {
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, 26, 27, 28, 29, 30, 31, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, IV, IV, IV, IV, IV,
+        IV, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    }};
+
+const base32_alphabet base32_hexAlphabet = {
+    .characters = "0123456789ABCDEFGHIJKLMNOPQRSTUV",
+    .padding = '=',
+    .reverse = {
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, IV, IV, IV, IV, IV, IV,
+        IV, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30, 31, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30, 31, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    }};
+
+const base32_alphabet base32_crockfordAlphabet = {
+    .characters = "0123456789ABCDEFGHJKMNPQRSTVWXYZ",
+    .padding = '\0',
+    .reverse = {
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, IV, IV, IV, IV, IV, IV,
+        IV, 10, 11, 12, 13, 14, 15, 16, 17, 1, 18, 19, 1, 20, 21, 0,
+        22, 23, 24, 25, 26, IV, 27, 28, 29, 30, 31, IV, IV, IV, IV, IV,
+        IV, 10, 11, 12, 13, 14, 15, 16, 17, 1, 18, 19, 1, 20, 21, 0,
+        22, 23, 24, 25, 26, IV, 27, 28, 29, 30, 31, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    }};
+
+const base32_alphabet base32_zAlphabet = {
+    .characters = "ybndrfg8ejkmcpqxot1uwisza345h769",
+    .padding = '\0',
+    .reverse = {
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, 18, IV, 25, 26, 27, 30, 29, 7, 31, IV, IV, IV, IV, IV, IV,
+        IV, 24, 1, 12, 3, 8, 5, 6, 28, 21, 9, 10, IV, 11, 2, 16,
+        13, 14, 4, 22, 17, 19, IV, 20, 15, 0, 23, IV, IV, IV, IV, IV,
+        IV, 24, 1, 12, 3, 8, 5, 6, 28, 21, 9, 10, IV, 11, 2, 16,
+        13, 14, 4, 22, 17, 19, IV, 20, 15, 0, 23, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    }};
+#undef IV
 
 /**
  * @brief Calculates the number of base32 padding characters required for a
@@ -38,45 +163,434 @@ static const char *base32_alphabet =
  * @param inputLength Length of the input byte array.
  * @return Number of '=' padding characters (0, 1, 3, 4, or 6).
  */
-uint8_t base32_padding(uint32_t inputLength);
+uint8_t base32_padding(size_t inputLength);
+
+/**
+ * @brief Decodes complete groups of 8 characters into 5 bytes each.
+ *
+ * Stops at the first group containing padding or an invalid character.
+ *
+ * @param[out] decodedBytes Output buffer, 5 bytes per group.
+ * @param[in] src Input characters.
+ * @param[in] groups Maximum number of groups to decode.
+ * @param[in] reverse Reverse table of the alphabet.
+ * @return size_t Number of decoded groups.
+ */
+static size_t base32_decodeGroups(uint8_t *decodedBytes,
+                                  const uint8_t *src,
+                                  size_t groups,
+                                  const uint8_t *reverse);
+
+/**
+ * @brief Encodes the bytes including padding, without NULL-terminator.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per started group.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @param[in] alphabet Output alphabet, without padding the output ends
+ * after the last character with data.
+ * @return size_t Number of written characters.
+ */
+static size_t base32_encodeBlock(char *encodedString,
+                                 const uint8_t *srcBytes,
+                                 size_t srcLength,
+                                 const base32_alphabet *alphabet);
+
+/**
+ * @brief Encodes one complete group of 5 bytes into 8 characters.
+ *
+ * The group is loaded into a 64-bit word and the characters are extracted
+ * with fixed shifts.
+ *
+ * @param[out] encodedString Output buffer for the 8 characters.
+ * @param[in] srcBytes The 5 input bytes.
+ * @param[in] characters Characters of the 32 values.
+ */
+static void base32_encodeGroup(char *encodedString,
+                               const uint8_t *srcBytes,
+                               const char *characters);
+
+/**
+ * @brief Encodes the gathered complete groups of batch items and copies the
+ * characters to the items.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] offsets Output offsets of the items.
+ * @param[in] items All batch items.
+ * @param[in] first Index of the first gathered item.
+ * @param[in] end Index after the last gathered item.
+ * @param[in] gathered Concatenated complete groups of the gathered items.
+ * @param[in] gatheredLength Number of gathered bytes, a multiple of 5.
+ */
+static void base32_encodeGathered(char *arena,
+                                  const size_t *offsets,
+                                  const baseX_batchItem *items,
+                                  size_t first,
+                                  size_t end,
+                                  const uint8_t *gathered,
+                                  size_t gatheredLength);
+
+/**
+ * @brief Decodes the gathered complete groups of batch items, copies the
+ * bytes to the items and decodes the last group of every item.
+ *
+ * The last group of an item may be incomplete or padded and is not gathered.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] offsets Output offsets of the items.
+ * @param[in] items All batch items.
+ * @param[in] first Index of the first gathered item.
+ * @param[in] end Index after the last gathered item.
+ * @param[in] gathered Concatenated complete groups of the gathered items.
+ * @param[in] groups Number of gathered groups.
+ * @param[out] errorItem Index of the failed item, may be NULL.
+ * @return baseX_returnType BASEX_OK or BASEX_SRCERROR.
+ */
+static baseX_returnType base32_decodeGathered(uint8_t *arena,
+                                              const size_t *offsets,
+                                              const baseX_batchItem *items,
+                                              size_t first,
+                                              size_t end,
+                                              const char *gathered,
+                                              size_t groups,
+                                              size_t *errorItem);
+
+/**
+ * @brief Decodes the last group of a batch item behind its complete groups.
+ *
+ * @param[out] arena Output buffer of all items.
+ * @param[in] offsets Output offsets of the items.
+ * @param[in] items All batch items.
+ * @param[in] item Index of the item.
+ * @return baseX_returnType BASEX_SRCERROR if the group is invalid or its
+ * length does not match the offsets.
+ */
+static baseX_returnType base32_decodeBatchTail(uint8_t *arena,
+                                               const size_t *offsets,
+                                               const baseX_batchItem *items,
+                                               size_t item);
+
+/**
+ * @brief Returns the value of the base32 character without branches or table
+ * lookups.
+ *
+ * @param[in] c The character to convert, upper- or lowercase.
+ * @param[in,out] invalid Set to all ones if c is no base32 character.
+ * @return uint32_t The value of the character, 0 if it is invalid.
+ */
+static inline uint32_t base32_constantTimeValue(uint32_t c,
+                                                uint32_t *invalid);
+
+#ifdef BASEX_X86_BMI2
+/**
+ * @brief Decodes complete groups with BMI2, PEXT gathers the 8 values of a
+ * group into 40 bits.
+ *
+ * @param[out] decodedBytes Output buffer, 5 bytes per group.
+ * @param[in] src Input characters.
+ * @param[in] groups Maximum number of groups to decode.
+ * @param[in] reverse Reverse table of the alphabet.
+ * @return size_t Number of decoded groups, stops before the first group
+ * containing padding or an invalid character.
+ */
+static size_t base32_decodeBMI2(uint8_t *decodedBytes,
+                                const uint8_t *src,
+                                size_t groups,
+                                const uint8_t *reverse);
+
+/**
+ * @brief Encodes complete groups with BMI2, PDEP scatters the 40 bits of a
+ * group into 8 bytes.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per group.
+ * @param[in] srcBytes Input bytes, 5 per group.
+ * @param[in] groups Number of groups to encode.
+ * @param[in] characters Characters of the 32 values.
+ */
+static void base32_encodeBMI2(char *encodedString,
+                              const uint8_t *srcBytes,
+                              size_t groups,
+                              const char *characters);
+#endif
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Checks RFC 4648 characters in blocks of 16 with SSE4.1.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Position of the first character outside of the alphabet
+ * (e.g. the padding), or the number of checked characters (a multiple of 16)
+ * if there is none.
+ */
+static size_t base32_validateSSE41(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Checks RFC 4648 characters in blocks of 32 with AVX2.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @return size_t Position of the first character outside of the alphabet
+ * (e.g. the padding), or the number of checked characters (a multiple of 32)
+ * if there is none.
+ */
+static size_t base32_validateAVX2(const char *srcString, size_t srcLength);
+
+/**
+ * @brief Decodes blocks of 8 groups (64 characters) with AVX-512 VBMI.
+ *
+ * VPERMI2B looks the characters up in the first 128 entries of the reverse
+ * table, so case folding and invalid characters are handled in the same
+ * pass.
+ *
+ * @param[out] decodedBytes Output buffer, 40 bytes per block.
+ * @param[in] src Input characters.
+ * @param[in] groups Maximum number of groups to decode.
+ * @param[in] reverse Reverse table of the alphabet.
+ * @return size_t Number of decoded groups (a multiple of 8), stops before the
+ * first block containing padding or an invalid character.
+ */
+static size_t base32_decodeVBMI(uint8_t *decodedBytes,
+                                const uint8_t *src,
+                                size_t groups,
+                                const uint8_t *reverse);
+
+/**
+ * @brief Encodes blocks of 8 groups (40 bytes) with AVX-512 VBMI.
+ *
+ * VPMULTISHIFTQB extracts the 5 bit values and VPERMB maps them to the
+ * characters.
+ *
+ * @param[out] encodedString Output buffer, 64 characters per block.
+ * @param[in] srcBytes Input bytes, 5 per group.
+ * @param[in] groups Number of groups to encode.
+ * @param[in] characters Characters of the 32 values.
+ * @return size_t Number of encoded groups (a multiple of 8).
+ */
+static size_t base32_encodeVBMI(char *encodedString,
+                                const uint8_t *srcBytes,
+                                size_t groups,
+                                const char *characters);
+
+/**
+ * @brief Decodes blocks of 4 groups (32 RFC 4648 characters) with AVX2.
+ *
+ * @param[out] decodedBytes Output buffer, 20 bytes per block.
+ * @param[in] src Input characters.
+ * @param[in] groups Maximum number of groups to decode.
+ * @return size_t Number of decoded groups (a multiple of 4), stops before the
+ * first block containing padding or an invalid character.
+ */
+static size_t base32_decodeAVX2(uint8_t *decodedBytes,
+                                const uint8_t *src,
+                                size_t groups);
+
+/**
+ * @brief Encodes blocks of 4 groups (20 bytes) with AVX2.
+ *
+ * The 16 bit words holding the 5 bit values are shifted into place with
+ * VPMULHUW, two VPSHUFB map the values to the characters.
+ *
+ * @param[out] encodedString Output buffer, 32 characters per block.
+ * @param[in] srcBytes Input bytes, 5 per group.
+ * @param[in] groups Number of groups to encode.
+ * @param[in] characters Characters of the 32 values.
+ * @return size_t Number of encoded groups (a multiple of 4).
+ */
+static size_t base32_encodeAVX2(char *encodedString,
+                                const uint8_t *srcBytes,
+                                size_t groups,
+                                const char *characters);
+#endif
 
 baseX_returnType base32_decodeString(uint8_t *decodedBytes,
-                                     uint32_t *decodedLength,
-                                     uint32_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
                                      const char *srcString)
 {
+  if (!srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  return base32_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                        srcString, strlen(srcString));
+}
 
-  if (!decodedBytes || !decodedLength || !srcString) {
+baseX_returnType base32_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength)
+{
+  return base32_decodeNAlphabet(decodedBytes, decodedLength, decodedBytesSize,
+                                srcString, srcLength, &base32_rfcAlphabet);
+}
+
+baseX_returnType base32_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength)
+{
+  if (!buffer) {
+    return BASEX_ARGUMENTS;
+  }
+  // A group is read completely before its 5 bytes are written
+  return base32_decodeN((uint8_t *)buffer, decodedLength, length, buffer,
+                        length);
+}
+
+baseX_returnType base32_decodeIgnore(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     size_t srcLength,
+                                     const baseX_ignoreSet *ignore)
+{
+  if (!decodedBytes || !decodedLength || !srcString || !ignore) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t run = baseX_ignoreSpan(srcString, srcLength, ignore);
+  if (run == srcLength) {
+    return base32_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                          srcString, srcLength);
+  }
+
+  base32_decodeContext ctx;
+  base32_decodeInit(&ctx);
+  size_t wPos = 0;
+  size_t rPos = 0;
+  for (;;) {
+    size_t written = 0;
+    baseX_returnType ret =
+        base32_decodeUpdate(&ctx, decodedBytes + wPos, decodedBytesSize - wPos,
+                            &written, srcString + rPos, run);
+    if (BASEX_OK != ret) {
+      return ret;
+    }
+    wPos += written;
+    rPos += run;
+    while (rPos < srcLength && ignore->characters[(uint8_t)srcString[rPos]]) {
+      rPos++;
+    }
+    if (rPos == srcLength) {
+      break;
+    }
+    run = baseX_ignoreSpan(srcString + rPos, srcLength - rPos, ignore);
+  }
+  size_t written = 0;
+  baseX_returnType ret = base32_decodeFinal(
+      &ctx, decodedBytes + wPos, decodedBytesSize - wPos, &written);
+  *decodedLength = wPos + written;
+  return ret;
+}
+
+baseX_returnType base32_validate(const char *srcString,
+                                 size_t srcLength,
+                                 size_t *errorOffset)
+{
+  return base32_validateAlphabet(srcString, srcLength, errorOffset,
+                                 &base32_rfcAlphabet);
+}
+
+baseX_returnType base32_validateAlphabet(const char *srcString,
+                                         size_t srcLength,
+                                         size_t *errorOffset,
+                                         const base32_alphabet *alphabet)
+{
+  if (!srcString || !alphabet) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  // The vectorized class check knows the RFC 4648 characters only
+  if (&base32_rfcAlphabet == alphabet) {
+    uint32_t features = baseX_cpuFeatures();
+    if (features & BASEX_CPU_AVX2) {
+      i = base32_validateAVX2(srcString, srcLength);
+    } else if (features & BASEX_CPU_SSE41) {
+      i = base32_validateSSE41(srcString, srcLength);
+    }
+  }
+#endif
+  while (i < srcLength &&
+         !(alphabet->reverse[(uint8_t)srcString[i]] & BASE32_INVALID)) {
+    i++;
+  }
+  if (i < srcLength && alphabet->padding &&
+      alphabet->padding == srcString[i]) {
+    // The decoder accepts up to the padding of the last byte, a single
+    // padding character after a complete group
+    size_t padding = base32_padding(BASE32_MAX_DECODED_LENGTH(i));
+    size_t end = i + (padding ? padding : 1);
+    i++;
+    while (i < srcLength && i < end && alphabet->padding == srcString[i]) {
+      i++;
+    }
+  }
+  if (i == srcLength && srcLength) {
+    return BASEX_OK;
+  }
+  if (errorOffset) {
+    *errorOffset = i;
+  }
+  return BASEX_SRCERROR;
+}
+
+baseX_returnType base32_decodeNAlphabet(uint8_t *decodedBytes,
+                                        size_t *decodedLength,
+                                        size_t decodedBytesSize,
+                                        const char *srcString,
+                                        size_t srcLength,
+                                        const base32_alphabet *alphabet)
+{
+
+  if (!decodedBytes || !decodedLength || !srcString || !alphabet) {
     return BASEX_ARGUMENTS;
   }
+  // An unpadded alphabet has no padding character to match
+  const int padding = alphabet->padding ? (uint8_t)alphabet->padding : -1;
 
-  uint32_t wPos = 0; // Write position
-  uint32_t rPos = 0; // Read position
+  size_t wPos = 0;   // Write position
+  size_t rPos = 0;   // Read position
   uint32_t bits = 0; // Number of bits
   uint32_t vbit = 0; // Current bits read
 
-  uint32_t srcLength = (uint32_t)strlen(srcString);
-
   if (0 == srcLength) {
     return BASEX_SRCERROR;
   }
 
+  // Decode full groups of 8 characters into 5 bytes. A group is only taken
+  // if the output has room for it and, unless it is the last one, for at
+  // least one more byte. Everything else is left to the tail loop below.
+  size_t groups = srcLength / BASE32_GROUP_CHARS;
+  if (groups > decodedBytesSize / BASE32_GROUP_BYTES) {
+    groups = decodedBytesSize / BASE32_GROUP_BYTES;
+  }
+  if (groups && (groups * BASE32_GROUP_BYTES == decodedBytesSize) &&
+      (groups * BASE32_GROUP_CHARS != srcLength)) {
+    groups--;
+  }
+  groups = base32_decodeGroups(decodedBytes, (const uint8_t *)srcString,
+                               groups, alphabet->reverse);
+  rPos = groups * BASE32_GROUP_CHARS;
+  wPos = groups * BASE32_GROUP_BYTES;
+
+  // Tail: last partial group, padding and error reporting
   while ((rPos < srcLength) || (vbit >= 8)) {
-    if (wPos >= decodedBytesSize) {
+    // A full buffer is only accepted if the padding follows
+    if ((wPos >= decodedBytesSize) &&
+        ((vbit >= 8) || (padding != (uint8_t)srcString[rPos]))) {
       return BASEX_OVERFLOW;
     }
     if ((rPos < srcLength) && (vbit < 8)) {
-      const char *p;
       char c = srcString[rPos++];
 
-      if (paddingCharacter == c) {
+      if (padding == (uint8_t)c) {
         /* padding character */
         uint8_t expectedPadding = base32_padding(wPos);
 
         for (size_t i = 1; i < expectedPadding && rPos < srcLength;
              i++, rPos++) {
           // Check only accepted padding bytes
-          if (paddingCharacter != srcString[rPos]) {
+          if (padding != (uint8_t)srcString[rPos]) {
             return BASEX_SRCERROR;
           }
         }
@@ -86,12 +600,12 @@ baseX_returnType base32_decodeString(uint8_t *decodedBytes,
         }
         break;
       }
-      p = strchr(base32_alphabet, toupper(c));
-      if (!p) {
+      uint8_t value = alphabet->reverse[(uint8_t)c];
+      if (value & BASE32_INVALID) {
         /* invalid character */
         return BASEX_SRCERROR;
       }
-      bits = (bits << BASE32_BIT_LENGTH) | (uint32_t)(p - base32_alphabet);
+      bits = (bits << BASE32_BIT_LENGTH) | value;
       vbit += BASE32_BIT_LENGTH;
     }
     if (vbit >= 8) {
@@ -103,52 +617,516 @@ baseX_returnType base32_decodeString(uint8_t *decodedBytes,
   return BASEX_OK;
 }
 
+baseX_returnType base32_decodeConstantTime(uint8_t *decodedBytes,
+                                           size_t *decodedLength,
+                                           size_t decodedBytesSize,
+                                           const char *srcString,
+                                           size_t srcLength)
+{
+  if (!decodedBytes || !decodedLength || !srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  if (0 == srcLength) {
+    return BASEX_SRCERROR;
+  }
+
+  // The padding only depends on the input length, not on the secret
+  size_t dataLength = srcLength;
+  while (dataLength && srcLength - dataLength < 6 &&
+         paddingCharacter == srcString[dataLength - 1]) {
+    dataLength--;
+  }
+  size_t tailLength = dataLength % BASE32_GROUP_CHARS;
+  size_t tailBytes = tailLength * BASE32_BIT_LENGTH / 8;
+  // Padding has to complete the last group, 1, 3 and 6 characters are no
+  // complete bytes
+  if ((dataLength != srcLength && (srcLength % BASE32_GROUP_CHARS)) ||
+      (tailBytes * 8 + BASE32_BIT_LENGTH - 1) / BASE32_BIT_LENGTH !=
+          tailLength) {
+    return BASEX_SRCERROR;
+  }
+  size_t outputLength =
+      dataLength / BASE32_GROUP_CHARS * BASE32_GROUP_BYTES + tailBytes;
+  *decodedLength = outputLength;
+  if (outputLength > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  // Invalid characters are collected and only reported after the last one
+  const uint8_t *src = (const uint8_t *)srcString;
+  uint32_t invalid = 0;
+  for (size_t rPos = 0; rPos < dataLength; rPos += BASE32_GROUP_CHARS) {
+    size_t length = dataLength - rPos;
+    if (length > BASE32_GROUP_CHARS) {
+      length = BASE32_GROUP_CHARS;
+    }
+    uint64_t group = 0;
+    for (size_t i = 0; i < length; i++) {
+      group = (group << BASE32_BIT_LENGTH) |
+              base32_constantTimeValue(src[rPos + i], &invalid);
+    }
+    group <<= BASE32_BIT_LENGTH * (BASE32_GROUP_CHARS - length);
+    size_t bytes = length * BASE32_BIT_LENGTH / 8;
+    for (size_t i = 0; i < bytes; i++) {
+      *decodedBytes++ = (uint8_t)(group >> (32 - 8 * i));
+    }
+  }
+  return invalid ? BASEX_SRCERROR : BASEX_OK;
+}
+
 baseX_returnType base32_encodeBytes(char *encodedString,
-                                    uint32_t encodedSize,
+                                    size_t encodedSize,
                                     const uint8_t *srcBytes,
-                                    uint32_t srcLength)
+                                    size_t srcLength)
+{
+  return base32_encodeBytesAlphabet(encodedString, encodedSize, srcBytes,
+                                    srcLength, &base32_rfcAlphabet);
+}
+
+baseX_returnType base32_encodeBytesAlphabet(char *encodedString,
+                                            size_t encodedSize,
+                                            const uint8_t *srcBytes,
+                                            size_t srcLength,
+                                            const base32_alphabet *alphabet)
+{
+
+  if (!encodedString || !srcBytes || !alphabet) {
+    return BASEX_ARGUMENTS;
+  }
+
+  size_t outputLength = base32_encodedLengthAlphabet(srcLength, alphabet);
+  if (outputLength >= encodedSize) { // +1 for null terminator
+    return BASEX_OVERFLOW;
+  }
+
+  outputLength =
+      base32_encodeBlock(encodedString, srcBytes, srcLength, alphabet);
+  encodedString[outputLength] = '\0';
+  return BASEX_OK;
+}
+
+baseX_returnType base32_encodeBytesLayout(char *encodedString,
+                                          size_t encodedSize,
+                                          const uint8_t *srcBytes,
+                                          size_t srcLength,
+                                          const base32_alphabet *alphabet,
+                                          const baseX_layout *layout)
+{
+  baseX_layoutWriter writer;
+  if (!srcBytes || !alphabet ||
+      BASEX_OK != baseX_layoutInit(&writer, encodedString, layout)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t outputLength = base32_encodedLengthLayout(srcLength, alphabet, layout);
+  if (outputLength >= encodedSize) { // +1 for null terminator
+    return BASEX_OVERFLOW;
+  }
+
+  // Encode in steps which stay in the L1 cache and lay them out
+  char stage[BASE32_LAYOUT_STAGE / BASE32_GROUP_BYTES * BASE32_GROUP_CHARS];
+  for (size_t i = 0; i < srcLength; i += BASE32_LAYOUT_STAGE) {
+    size_t n = srcLength - i;
+    if (n > BASE32_LAYOUT_STAGE) {
+      n = BASE32_LAYOUT_STAGE;
+    }
+    baseX_layoutWrite(&writer, stage,
+                      base32_encodeBlock(stage, srcBytes + i, n, alphabet));
+  }
+  encodedString[outputLength] = '\0';
+  return BASEX_OK;
+}
+
+size_t base32_encodedLengthAlphabet(size_t srcLength,
+                                    const base32_alphabet *alphabet)
+{
+  size_t length = base32_encodedLength(srcLength);
+  if (SIZE_MAX == length || !alphabet || alphabet->padding) {
+    return length;
+  }
+  return length - base32_padding(srcLength);
+}
+
+baseX_returnType base32_alphabetInit(base32_alphabet *alphabet,
+                                     const char *characters,
+                                     char padding)
+{
+  if (!alphabet || !characters) {
+    return BASEX_ARGUMENTS;
+  }
+  const size_t size = sizeof(alphabet->characters) - 1;
+  for (size_t i = 0; i < size; i++) {
+    if (!characters[i] || padding == characters[i] ||
+        memchr(characters, characters[i], i)) {
+      return BASEX_ARGUMENTS; // Not decodable
+    }
+  }
+  memcpy(alphabet->characters, characters, size);
+  alphabet->characters[size] = '\0';
+  alphabet->padding = padding;
+  memset(alphabet->reverse, BASE32_INVALID, sizeof(alphabet->reverse));
+  for (uint8_t i = 0; i < size; i++) {
+    alphabet->reverse[(uint8_t)characters[i]] = i;
+  }
+  // Fold the case of ASCII letters whose other case is not used, independent
+  // of the locale. The padding character keeps its meaning.
+  for (uint8_t i = 0; i < size; i++) {
+    uint8_t c = (uint8_t)characters[i];
+    uint8_t other = (('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z'))
+                        ? (uint8_t)(c ^ 0x20)
+                        : c;
+    if (other != c && other != (uint8_t)padding &&
+        (alphabet->reverse[other] & BASE32_INVALID)) {
+      alphabet->reverse[other] = i;
+    }
+  }
+  return BASEX_OK;
+}
+
+size_t base32_encodedLengthLayout(size_t srcLength,
+                                  const base32_alphabet *alphabet,
+                                  const baseX_layout *layout)
+{
+  size_t length = base32_encodedLengthAlphabet(srcLength, alphabet);
+  if (SIZE_MAX == length) {
+    return SIZE_MAX;
+  }
+  return baseX_layoutLength(length, layout);
+}
+
+size_t base32_encodedLength(size_t srcLength)
+{
+  size_t groups = srcLength / BASE32_GROUP_BYTES +
+                  (srcLength % BASE32_GROUP_BYTES ? 1 : 0);
+  if (groups > SIZE_MAX / BASE32_GROUP_CHARS) {
+    return SIZE_MAX; // Output length not representable
+  }
+  return groups * BASE32_GROUP_CHARS;
+}
+
+size_t base32_maxDecodedLength(size_t srcLength)
+{
+  return BASE32_MAX_DECODED_LENGTH(srcLength);
+}
+
+size_t base32_decodedLength(const char *srcString, size_t srcLength)
 {
+  // At most 6 padding characters follow the data of the last group
+  for (uint8_t i = 0; i < BASE32_GROUP_CHARS - 2 && srcLength &&
+                      paddingCharacter == srcString[srcLength - 1];
+       i++) {
+    srcLength--;
+  }
+  return BASE32_MAX_DECODED_LENGTH(srcLength);
+}
 
-  if (!encodedString || !srcBytes) {
+baseX_returnType base32_encodeInit(base32_encodeContext *ctx)
+{
+  if (!ctx) {
     return BASEX_ARGUMENTS;
   }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
 
-  uint32_t outputLength = ((srcLength + 4) / BASE32_BIT_LENGTH) * 8;
-  if (encodedSize < (outputLength + 1)) { // +1 for null terminator
+baseX_returnType base32_encodeUpdate(base32_encodeContext *ctx,
+                                     char *encodedString,
+                                     size_t encodedSize,
+                                     size_t *encodedLength,
+                                     const uint8_t *srcBytes,
+                                     size_t srcLength)
+{
+  if (!ctx || !encodedString || !encodedLength || (!srcBytes && srcLength)) {
+    return BASEX_ARGUMENTS;
+  }
+  if ((ctx->groupLength + srcLength) / BASE32_GROUP_BYTES >
+      encodedSize / BASE32_GROUP_CHARS) {
     return BASEX_OVERFLOW;
   }
 
-  uint32_t buffer = 0;
-  int bitsLeft = 0;
-  uint32_t outIndex = 0;
+  size_t outPos = 0;
+  // Complete the pending group first
+  if (ctx->groupLength) {
+    while (ctx->groupLength < BASE32_GROUP_BYTES && srcLength) {
+      ctx->group[ctx->groupLength++] = *srcBytes++;
+      srcLength--;
+    }
+    if (ctx->groupLength < BASE32_GROUP_BYTES) {
+      *encodedLength = 0;
+      return BASEX_OK;
+    }
+    outPos += base32_encodeBlock(encodedString, ctx->group,
+                                 BASE32_GROUP_BYTES, &base32_rfcAlphabet);
+    ctx->groupLength = 0;
+  }
 
-  for (uint32_t i = 0; i < srcLength; ++i) {
-    buffer <<= 8;
-    buffer |= srcBytes[i] & 0xFF;
-    bitsLeft += 8;
+  size_t blockLength = srcLength - (srcLength % BASE32_GROUP_BYTES);
+  outPos += base32_encodeBlock(encodedString + outPos, srcBytes, blockLength,
+                               &base32_rfcAlphabet);
+  for (size_t i = blockLength; i < srcLength; i++) {
+    ctx->group[ctx->groupLength++] = srcBytes[i];
+  }
+  *encodedLength = outPos;
+  return BASEX_OK;
+}
 
-    while (bitsLeft >= BASE32_BIT_LENGTH) {
-      encodedString[outIndex++] =
-          base32_alphabet[(buffer >> (bitsLeft - BASE32_BIT_LENGTH)) & 0x1F];
-      bitsLeft -= BASE32_BIT_LENGTH;
+baseX_returnType base32_encodeFinal(base32_encodeContext *ctx,
+                                    char *encodedString,
+                                    size_t encodedSize,
+                                    size_t *encodedLength)
+{
+  if (!ctx || !encodedString || !encodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  if (ctx->groupLength && encodedSize < BASE32_GROUP_CHARS) {
+    return BASEX_OVERFLOW;
+  }
+  *encodedLength = base32_encodeBlock(encodedString, ctx->group,
+                                      ctx->groupLength, &base32_rfcAlphabet);
+  ctx->groupLength = 0;
+  return BASEX_OK;
+}
+
+baseX_returnType base32_decodeInit(base32_decodeContext *ctx)
+{
+  if (!ctx) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
+
+baseX_returnType base32_decodeUpdate(base32_decodeContext *ctx,
+                                     uint8_t *decodedBytes,
+                                     size_t decodedBytesSize,
+                                     size_t *decodedLength,
+                                     const char *srcString,
+                                     size_t srcLength)
+{
+  if (!ctx || !decodedBytes || !decodedLength || (!srcString && srcLength)) {
+    return BASEX_ARGUMENTS;
+  }
+  // Padding characters never complete a group, an exact buffer is accepted
+  // like in base32_decodeNAlphabet()
+  size_t dataLength = srcLength;
+  while (dataLength && paddingCharacter == srcString[dataLength - 1]) {
+    dataLength--;
+  }
+  if ((ctx->groupLength + dataLength) / BASE32_GROUP_CHARS >
+      decodedBytesSize / BASE32_GROUP_BYTES) {
+    return BASEX_OVERFLOW;
+  }
+  if (srcLength) {
+    ctx->started = 1;
+  }
+
+  const uint8_t *src = (const uint8_t *)srcString;
+  size_t outPos = 0;
+  size_t rPos = 0;
+  while (rPos < srcLength) {
+    if (0 == ctx->groupLength && 0 == ctx->paddingLength) {
+      size_t groups = base32_decodeGroups(
+          decodedBytes + outPos, src + rPos,
+          (srcLength - rPos) / BASE32_GROUP_CHARS, base32_rfcAlphabet.reverse);
+      outPos += groups * BASE32_GROUP_BYTES;
+      rPos += groups * BASE32_GROUP_CHARS;
+      if (rPos == srcLength) {
+        break;
+      }
+    }
+
+    char c = srcString[rPos++];
+    if (ctx->paddingLength) {
+      // Only further padding characters are allowed after the first one
+      if (paddingCharacter != c || ++ctx->paddingLength > ctx->maxPadding) {
+        return BASEX_SRCERROR;
+      }
+      continue;
+    }
+    if (paddingCharacter == c) {
+      uint8_t expectedPadding =
+          base32_padding((size_t)ctx->groupLength * BASE32_BIT_LENGTH / 8);
+      ctx->maxPadding = expectedPadding ? expectedPadding : 1;
+      ctx->paddingLength = 1;
+      continue;
+    }
+    uint8_t value = base32_rfcAlphabet.reverse[(uint8_t)c];
+    if (value & BASE32_INVALID) {
+      return BASEX_SRCERROR;
+    }
+    ctx->group[ctx->groupLength++] = value;
+    if (BASE32_GROUP_CHARS == ctx->groupLength) {
+      uint64_t group = 0;
+      for (uint8_t i = 0; i < BASE32_GROUP_CHARS; i++) {
+        group = (group << BASE32_BIT_LENGTH) | ctx->group[i];
+      }
+      for (int8_t shift = 32; shift >= 0; shift -= 8) {
+        decodedBytes[outPos++] = (uint8_t)(group >> shift);
+      }
+      ctx->groupLength = 0;
     }
   }
+  *decodedLength = outPos;
+  return BASEX_OK;
+}
 
-  if (bitsLeft > 0) {
-    buffer <<= (BASE32_BIT_LENGTH - bitsLeft);
-    encodedString[outIndex++] = base32_alphabet[buffer & 0x1F];
+baseX_returnType base32_decodeFinal(base32_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength)
+{
+  if (!ctx || !decodedBytes || !decodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  if (!ctx->started) {
+    return BASEX_SRCERROR;
+  }
+  // Remaining bits which do not form a complete byte are dropped
+  uint8_t outputLength =
+      (uint8_t)(ctx->groupLength * BASE32_BIT_LENGTH / 8);
+  if (outputLength > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+  uint64_t group = 0;
+  for (uint8_t i = 0; i < ctx->groupLength; i++) {
+    group = (group << BASE32_BIT_LENGTH) | ctx->group[i];
+  }
+  uint8_t bits = (uint8_t)(ctx->groupLength * BASE32_BIT_LENGTH);
+  for (uint8_t i = 0; i < outputLength; i++) {
+    bits = (uint8_t)(bits - 8);
+    decodedBytes[i] = (uint8_t)(group >> bits);
   }
+  ctx->groupLength = 0;
+  *decodedLength = outputLength;
+  return BASEX_OK;
+}
 
-  // Padding
-  while (outIndex % 8 != 0) {
-    encodedString[outIndex++] = paddingCharacter;
+baseX_returnType base32_encodeBatch(char *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count)
+{
+  if (!arena || !offsets || (!items && count)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!items[i].data && items[i].length) {
+      return BASEX_ARGUMENTS;
+    }
+    size_t length = base32_encodedLength(items[i].length);
+    if (length > SIZE_MAX - total) {
+      return BASEX_OVERFLOW; // Output length not representable
+    }
+    offsets[i] = total;
+    total += length;
+  }
+  offsets[count] = total;
+  if (total > arenaSize) {
+    return BASEX_OVERFLOW;
   }
 
-  encodedString[outIndex] = '\0';
+  // The complete groups of short items are gathered and encoded together by
+  // the vectorized kernels, the incomplete groups are encoded in place
+  uint8_t stage[BASE32_BATCH_STAGE];
+  size_t staged = 0;
+  size_t stageFirst = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t length = items[i].length;
+    size_t groupBytes = length - length % BASE32_GROUP_BYTES;
+    if (staged + groupBytes > BASE32_BATCH_STAGE ||
+        groupBytes > BASE32_BATCH_STAGE / 2) {
+      base32_encodeGathered(arena, offsets, items, stageFirst, i, stage,
+                            staged);
+      staged = 0;
+      stageFirst = i;
+    }
+    if (groupBytes > BASE32_BATCH_STAGE / 2) {
+      base32_encodeBlock(arena + offsets[i], items[i].data, length,
+                         &base32_rfcAlphabet);
+      stageFirst = i + 1;
+      continue;
+    }
+    if (groupBytes) {
+      memcpy(stage + staged, items[i].data, groupBytes);
+      staged += groupBytes;
+    }
+    base32_encodeBlock(arena + offsets[i] + BASE32_ENCODED_LENGTH(groupBytes),
+                       (const uint8_t *)items[i].data + groupBytes,
+                       length - groupBytes, &base32_rfcAlphabet);
+  }
+  base32_encodeGathered(arena, offsets, items, stageFirst, count, stage,
+                        staged);
   return BASEX_OK;
 }
 
-uint8_t base32_padding(uint32_t inputLength)
+baseX_returnType base32_decodeBatch(uint8_t *arena,
+                                    size_t arenaSize,
+                                    size_t *offsets,
+                                    const baseX_batchItem *items,
+                                    size_t count,
+                                    size_t *errorItem)
+{
+  if (!arena || !offsets || (!items && count)) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    if (!items[i].data) {
+      return BASEX_ARGUMENTS;
+    }
+    if (0 == items[i].length) {
+      if (errorItem) {
+        *errorItem = i;
+      }
+      return BASEX_SRCERROR;
+    }
+    // Exact for valid items, the others fail in base32_decodeBatchTail()
+    offsets[i] = total;
+    total += base32_decodedLength(items[i].data, items[i].length);
+  }
+  offsets[count] = total;
+  if (total > arenaSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  // Gather the complete groups before the last group of every item like
+  // base32_encodeBatch()
+  char stage[BASE32_BATCH_STAGE];
+  size_t staged = 0;
+  size_t stageFirst = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t groupChars =
+        (items[i].length - 1) / BASE32_GROUP_CHARS * BASE32_GROUP_CHARS;
+    if (staged + groupChars > BASE32_BATCH_STAGE ||
+        groupChars > BASE32_BATCH_STAGE / 2) {
+      if (BASEX_OK != base32_decodeGathered(arena, offsets, items,
+                                            stageFirst, i, stage,
+                                            staged / BASE32_GROUP_CHARS,
+                                            errorItem)) {
+        return BASEX_SRCERROR;
+      }
+      staged = 0;
+      stageFirst = i;
+    }
+    if (groupChars > BASE32_BATCH_STAGE / 2) {
+      if (BASEX_OK != base32_decodeGathered(arena, offsets, items, i, i + 1,
+                                            items[i].data,
+                                            groupChars / BASE32_GROUP_CHARS,
+                                            errorItem)) {
+        return BASEX_SRCERROR;
+      }
+      stageFirst = i + 1;
+      continue;
+    }
+    memcpy(stage + staged, items[i].data, groupChars);
+    staged += groupChars;
+  }
+  return base32_decodeGathered(arena, offsets, items, stageFirst, count,
+                               stage, staged / BASE32_GROUP_CHARS, errorItem);
+}
+
+uint8_t base32_padding(size_t inputLength)
 {
   switch (inputLength % 5) {
   case 1:
@@ -163,3 +1141,504 @@ uint8_t base32_padding(uint32_t inputLength)
     return 0;
   }
 }
+
+static size_t base32_decodeGroups(uint8_t *decodedBytes,
+                                  const uint8_t *src,
+                                  size_t groups,
+                                  const uint8_t *reverse)
+{
+  size_t done = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX512VBMI) {
+    done = base32_decodeVBMI(decodedBytes, src, groups, reverse);
+  } else if ((features & BASEX_CPU_AVX2) &&
+             base32_rfcAlphabet.reverse == reverse) {
+    // The vectorized mapping knows the RFC 4648 characters only
+    done = base32_decodeAVX2(decodedBytes, src, groups);
+  }
+  decodedBytes += done * BASE32_GROUP_BYTES;
+  src += done * BASE32_GROUP_CHARS;
+  groups -= done;
+#endif
+#ifdef BASEX_X86_BMI2
+  if (features & BASEX_CPU_BMI2) {
+    return done + base32_decodeBMI2(decodedBytes, src, groups, reverse);
+  }
+#endif
+  size_t g = 0;
+  for (; g < groups; g++) {
+    uint8_t invalid = 0;
+    uint64_t group = 0;
+    for (uint8_t i = 0; i < BASE32_GROUP_CHARS; i++) {
+      uint8_t value = reverse[src[i]];
+      invalid |= value;
+      group = (group << BASE32_BIT_LENGTH) | value;
+    }
+    if (invalid & BASE32_INVALID) {
+      break; // padding or invalid character
+    }
+    decodedBytes[0] = (uint8_t)(group >> 32);
+    decodedBytes[1] = (uint8_t)(group >> 24);
+    decodedBytes[2] = (uint8_t)(group >> 16);
+    decodedBytes[3] = (uint8_t)(group >> 8);
+    decodedBytes[4] = (uint8_t)group;
+    decodedBytes += BASE32_GROUP_BYTES;
+    src += BASE32_GROUP_CHARS;
+  }
+  return done + g;
+}
+
+static size_t base32_encodeBlock(char *encodedString,
+                                 const uint8_t *srcBytes,
+                                 size_t srcLength,
+                                 const base32_alphabet *alphabet)
+{
+  size_t groups = srcLength / BASE32_GROUP_BYTES;
+  uint8_t tailLength = (uint8_t)(srcLength % BASE32_GROUP_BYTES);
+  char *out = encodedString;
+
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  size_t done = 0;
+  if (features & BASEX_CPU_AVX512VBMI) {
+    done = base32_encodeVBMI(out, srcBytes, groups, alphabet->characters);
+  } else if (features & BASEX_CPU_AVX2) {
+    done = base32_encodeAVX2(out, srcBytes, groups, alphabet->characters);
+  }
+  srcBytes += done * BASE32_GROUP_BYTES;
+  out += done * BASE32_GROUP_CHARS;
+  groups -= done;
+#endif
+#ifdef BASEX_X86_BMI2
+  if (features & BASEX_CPU_BMI2) {
+    base32_encodeBMI2(out, srcBytes, groups, alphabet->characters);
+    srcBytes += groups * BASE32_GROUP_BYTES;
+    out += groups * BASE32_GROUP_CHARS;
+    groups = 0;
+  }
+#endif
+  for (size_t i = 0; i < groups; i++) {
+    base32_encodeGroup(out, srcBytes, alphabet->characters);
+    srcBytes += BASE32_GROUP_BYTES;
+    out += BASE32_GROUP_CHARS;
+  }
+
+  if (tailLength) {
+    // Encode the zero extended group and pad the characters without data
+    uint8_t group[BASE32_GROUP_BYTES] = {0};
+    char chars[BASE32_GROUP_CHARS];
+    memcpy(group, srcBytes, tailLength);
+    base32_encodeGroup(chars, group, alphabet->characters);
+    uint8_t dataChars = (uint8_t)((tailLength * BASEX_BYTE_BIT_LENGTH +
+                                   BASE32_BIT_LENGTH - 1) /
+                                  BASE32_BIT_LENGTH);
+    if (alphabet->padding) {
+      memset(chars + dataChars, alphabet->padding,
+             (size_t)(BASE32_GROUP_CHARS - dataChars));
+      dataChars = BASE32_GROUP_CHARS;
+    }
+    memcpy(out, chars, dataChars);
+    out += dataChars;
+  }
+  return (size_t)(out - encodedString);
+}
+
+static void base32_encodeGroup(char *encodedString,
+                               const uint8_t *srcBytes,
+                               const char *characters)
+{
+  uint64_t group = ((uint64_t)srcBytes[0] << 32) |
+                   ((uint64_t)srcBytes[1] << 24) |
+                   ((uint64_t)srcBytes[2] << 16) |
+                   ((uint64_t)srcBytes[3] << 8) | (uint64_t)srcBytes[4];
+  // Collect the characters first, so the stores cannot alias the input
+  char chars[BASE32_GROUP_CHARS] = {
+      characters[(group >> 35) & 0x1F],
+      characters[(group >> 30) & 0x1F],
+      characters[(group >> 25) & 0x1F],
+      characters[(group >> 20) & 0x1F],
+      characters[(group >> 15) & 0x1F],
+      characters[(group >> 10) & 0x1F],
+      characters[(group >> 5) & 0x1F],
+      characters[group & 0x1F]};
+  memcpy(encodedString, chars, BASE32_GROUP_CHARS);
+}
+
+static void base32_encodeGathered(char *arena,
+                                  const size_t *offsets,
+                                  const baseX_batchItem *items,
+                                  size_t first,
+                                  size_t end,
+                                  const uint8_t *gathered,
+                                  size_t gatheredLength)
+{
+  char chars[BASE32_ENCODED_LENGTH(BASE32_BATCH_STAGE)];
+  base32_encodeBlock(chars, gathered, gatheredLength, &base32_rfcAlphabet);
+  const char *src = chars;
+  for (size_t i = first; i < end; i++) {
+    size_t length = items[i].length / BASE32_GROUP_BYTES * BASE32_GROUP_CHARS;
+    memcpy(arena + offsets[i], src, length);
+    src += length;
+  }
+}
+
+static baseX_returnType base32_decodeGathered(uint8_t *arena,
+                                              const size_t *offsets,
+                                              const baseX_batchItem *items,
+                                              size_t first,
+                                              size_t end,
+                                              const char *gathered,
+                                              size_t groups,
+                                              size_t *errorItem)
+{
+  uint8_t bytes[BASE32_BATCH_STAGE / BASE32_GROUP_CHARS * BASE32_GROUP_BYTES];
+  // A single item is decoded directly into the arena. Only groups without
+  // padding are written, they lie within the output of their item.
+  uint8_t *decoded = (1 == end - first) ? arena + offsets[first] : bytes;
+  size_t done = base32_decodeGroups(decoded, (const uint8_t *)gathered,
+                                    groups, base32_rfcAlphabet.reverse);
+  size_t pos = 0;
+  size_t i = first;
+  for (; i < end; i++) {
+    size_t itemGroups = (items[i].length - 1) / BASE32_GROUP_CHARS;
+    if (pos + itemGroups > done) {
+      break; // padding or invalid character in a complete group
+    }
+    if (decoded == bytes) {
+      memcpy(arena + offsets[i], bytes + pos * BASE32_GROUP_BYTES,
+             itemGroups * BASE32_GROUP_BYTES);
+    }
+    pos += itemGroups;
+    if (BASEX_OK != base32_decodeBatchTail(arena, offsets, items, i)) {
+      break;
+    }
+  }
+  if (i == end) {
+    return BASEX_OK;
+  }
+  if (errorItem) {
+    *errorItem = i;
+  }
+  return BASEX_SRCERROR;
+}
+
+static baseX_returnType base32_decodeBatchTail(uint8_t *arena,
+                                               const size_t *offsets,
+                                               const baseX_batchItem *items,
+                                               size_t item)
+{
+  size_t groupChars =
+      (items[item].length - 1) / BASE32_GROUP_CHARS * BASE32_GROUP_CHARS;
+  size_t start = offsets[item] + BASE32_MAX_DECODED_LENGTH(groupChars);
+  uint8_t tail[BASE32_GROUP_BYTES];
+  size_t length = 0;
+  if (BASEX_OK != base32_decodeN(tail, &length, sizeof(tail),
+                                 (const char *)items[item].data + groupChars,
+                                 items[item].length - groupChars) ||
+      start + length != offsets[item + 1]) {
+    return BASEX_SRCERROR;
+  }
+  memcpy(arena + start, tail, length);
+  return BASEX_OK;
+}
+
+static inline uint32_t base32_constantTimeValue(uint32_t c,
+                                                uint32_t *invalid)
+{
+  // All ones if low <= c <= high: both differences are negative
+#define BASE32_RANGE(low, high)                                               \
+  (0u - ((((uint32_t)(low) - 1u - c) & (c - (uint32_t)(high) - 1u)) >> 31))
+  uint32_t upper = BASE32_RANGE('A', 'Z');
+  uint32_t lower = BASE32_RANGE('a', 'z');
+  uint32_t digit = BASE32_RANGE('2', '7');
+#undef BASE32_RANGE
+  *invalid |= ~(upper | lower | digit);
+  return (upper & (c - 'A')) | (lower & (c - 'a')) | (digit & (c - '2' + 26));
+}
+
+#ifdef BASEX_X86_BMI2
+__attribute__((target("bmi2"))) static size_t
+base32_decodeBMI2(uint8_t *decodedBytes,
+                  const uint8_t *src,
+                  size_t groups,
+                  const uint8_t *reverse)
+{
+  size_t g = 0;
+  for (; g < groups; g++) {
+    // One value per byte, the first one in the highest byte
+    uint64_t values = ((uint64_t)reverse[src[0]] << 56) |
+                      ((uint64_t)reverse[src[1]] << 48) |
+                      ((uint64_t)reverse[src[2]] << 40) |
+                      ((uint64_t)reverse[src[3]] << 32) |
+                      ((uint64_t)reverse[src[4]] << 24) |
+                      ((uint64_t)reverse[src[5]] << 16) |
+                      ((uint64_t)reverse[src[6]] << 8) |
+                      (uint64_t)reverse[src[7]];
+    if (values & (BASE32_INVALID * 0x0101010101010101ull)) {
+      break; // padding or invalid character
+    }
+    uint64_t group = _pext_u64(values, BASE32_VALUE_MASK);
+    if (g + 1 < groups) {
+      // The 3 surplus bytes are overwritten by the next group
+      uint64_t bytes = __builtin_bswap64(group << 24);
+      memcpy(decodedBytes, &bytes, sizeof(bytes));
+    } else {
+      decodedBytes[0] = (uint8_t)(group >> 32);
+      decodedBytes[1] = (uint8_t)(group >> 24);
+      decodedBytes[2] = (uint8_t)(group >> 16);
+      decodedBytes[3] = (uint8_t)(group >> 8);
+      decodedBytes[4] = (uint8_t)group;
+    }
+    decodedBytes += BASE32_GROUP_BYTES;
+    src += BASE32_GROUP_CHARS;
+  }
+  return g;
+}
+
+__attribute__((target("bmi2"))) static void
+base32_encodeBMI2(char *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t groups,
+                  const char *characters)
+{
+  for (size_t g = 0; g < groups; g++) {
+    uint64_t group;
+    if (g + 1 < groups) {
+      // The next group follows, load 8 bytes and drop the 3 surplus ones
+      memcpy(&group, srcBytes, sizeof(group));
+      group = __builtin_bswap64(group) >> 24;
+    } else {
+      group = ((uint64_t)srcBytes[0] << 32) | ((uint64_t)srcBytes[1] << 24) |
+              ((uint64_t)srcBytes[2] << 16) | ((uint64_t)srcBytes[3] << 8) |
+              (uint64_t)srcBytes[4];
+    }
+    uint64_t values = _pdep_u64(group, BASE32_VALUE_MASK);
+    char chars[BASE32_GROUP_CHARS] = {
+        characters[values >> 56],         characters[(values >> 48) & 0xFF],
+        characters[(values >> 40) & 0xFF], characters[(values >> 32) & 0xFF],
+        characters[(values >> 24) & 0xFF], characters[(values >> 16) & 0xFF],
+        characters[(values >> 8) & 0xFF], characters[values & 0xFF]};
+    memcpy(encodedString, chars, BASE32_GROUP_CHARS);
+    srcBytes += BASE32_GROUP_BYTES;
+    encodedString += BASE32_GROUP_CHARS;
+  }
+}
+#endif
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Marks the RFC 4648 characters of 16 input characters.
+ *
+ * @param[in] in The characters to check.
+ * @return __m128i 0xFF for every character of the alphabet.
+ */
+__attribute__((target("sse4.1"))) static inline __m128i
+base32_classSSE41(__m128i in)
+{
+  // Setting bit 5 folds 'A'-'Z' onto 'a'-'z' and keeps the digits unchanged
+  __m128i folded = _mm_or_si128(in, _mm_set1_epi8(0x20));
+  __m128i digit =
+      _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8('2')), in),
+                    _mm_cmpeq_epi8(_mm_min_epu8(in, _mm_set1_epi8('7')), in));
+  __m128i letter = _mm_and_si128(
+      _mm_cmpeq_epi8(_mm_max_epu8(folded, _mm_set1_epi8('a')), folded),
+      _mm_cmpeq_epi8(_mm_min_epu8(folded, _mm_set1_epi8('z')), folded));
+  return _mm_or_si128(digit, letter);
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base32_validateSSE41(const char *srcString, size_t srcLength)
+{
+  size_t i = 0;
+  for (; i + 16 <= srcLength; i += 16) {
+    __m128i valid =
+        base32_classSSE41(_mm_loadu_si128((const __m128i *)(srcString + i)));
+    int invalid = 0xFFFF ^ _mm_movemask_epi8(valid);
+    if (invalid) {
+      return i + (size_t)__builtin_ctz((unsigned)invalid);
+    }
+  }
+  return i;
+}
+
+/**
+ * @brief Converts 32 RFC 4648 characters into their 5 bit values.
+ *
+ * @param[in] in The characters to convert.
+ * @param[out] valid Set to 0xFF for every character of the alphabet.
+ * @return __m256i The values of the valid characters.
+ */
+__attribute__((target("avx2"))) static inline __m256i
+base32_valuesAVX2(__m256i in, __m256i *valid)
+{
+  // Setting bit 5 folds 'A'-'Z' onto 'a'-'z' and keeps the digits unchanged
+  __m256i folded = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+  __m256i digit = _mm256_and_si256(
+      _mm256_cmpeq_epi8(_mm256_max_epu8(in, _mm256_set1_epi8('2')), in),
+      _mm256_cmpeq_epi8(_mm256_min_epu8(in, _mm256_set1_epi8('7')), in));
+  __m256i letter = _mm256_and_si256(
+      _mm256_cmpeq_epi8(_mm256_max_epu8(folded, _mm256_set1_epi8('a')),
+                        folded),
+      _mm256_cmpeq_epi8(_mm256_min_epu8(folded, _mm256_set1_epi8('z')),
+                        folded));
+  *valid = _mm256_or_si256(digit, letter);
+  return _mm256_blendv_epi8(
+      _mm256_sub_epi8(in, _mm256_set1_epi8('2' - 26)),
+      _mm256_sub_epi8(folded, _mm256_set1_epi8('a')), letter);
+}
+
+__attribute__((target("avx2"))) static size_t
+base32_validateAVX2(const char *srcString, size_t srcLength)
+{
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m256i valid;
+    base32_valuesAVX2(_mm256_loadu_si256((const __m256i *)(srcString + i)),
+                      &valid);
+    unsigned invalid = ~(unsigned)_mm256_movemask_epi8(valid);
+    if (invalid) {
+      return i + (size_t)__builtin_ctz(invalid);
+    }
+  }
+  return i;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi"))) static size_t
+base32_decodeVBMI(uint8_t *decodedBytes,
+                  const uint8_t *src,
+                  size_t groups,
+                  const uint8_t *reverse)
+{
+  const __m512i reverseLow = _mm512_loadu_si512(reverse);
+  const __m512i reverseHigh = _mm512_loadu_si512(reverse + 64);
+  const __m512i store = _mm512_loadu_si512(base32_vbmiStore);
+  const __m512i pairWeights = _mm512_set1_epi16(0x0120); // v0 * 32 + v1
+  const __m512i quadWeights = _mm512_set1_epi32(0x00010400); // p0 << 10 | p1
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8) {
+    __m512i in = _mm512_loadu_si512(src + g * BASE32_GROUP_CHARS);
+    // Bit 6 selects the table half, characters of 0x80 and above keep their
+    // sign bit and are rejected with the invalid values
+    __m512i values = _mm512_permutex2var_epi8(reverseLow, in, reverseHigh);
+    if (_mm512_movepi8_mask(_mm512_or_si512(values, in))) {
+      break;
+    }
+    __m512i quads = _mm512_madd_epi16(
+        _mm512_maddubs_epi16(values, pairWeights), quadWeights);
+    // Join the two 20 bit halves of every group into its 40 bits
+    __m512i group = _mm512_or_si512(_mm512_slli_epi64(quads, 20),
+                                    _mm512_srli_epi64(quads, 32));
+    _mm512_mask_storeu_epi8(decodedBytes + g * BASE32_GROUP_BYTES,
+                            BASE32_VBMI_BLOCK_MASK,
+                            _mm512_permutexvar_epi8(store, group));
+  }
+  return g;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi"))) static size_t
+base32_encodeVBMI(char *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t groups,
+                  const char *characters)
+{
+  // VPERMB uses 6 index bits, the doubled alphabet ignores the sixth
+  const __m512i lookup = _mm512_broadcast_i64x4(
+      _mm256_loadu_si256((const __m256i *)characters));
+  const __m512i load = _mm512_loadu_si512(base32_vbmiLoad);
+  // Character i of a group starts at bit 35 - 5 * i
+  const __m512i shifts = _mm512_set1_epi64(0x00050A0F14191E23);
+  size_t g = 0;
+  for (; g + 8 <= groups; g += 8) {
+    __m512i in = _mm512_maskz_loadu_epi8(BASE32_VBMI_BLOCK_MASK,
+                                         srcBytes + g * BASE32_GROUP_BYTES);
+    __m512i group = _mm512_permutexvar_epi8(load, in);
+    __m512i values = _mm512_multishift_epi64_epi8(shifts, group);
+    _mm512_storeu_si512(encodedString + g * BASE32_GROUP_CHARS,
+                        _mm512_permutexvar_epi8(values, lookup));
+  }
+  return g;
+}
+
+__attribute__((target("avx2"))) static size_t
+base32_decodeAVX2(uint8_t *decodedBytes, const uint8_t *src, size_t groups)
+{
+  const __m256i pairWeights = _mm256_set1_epi16(0x0120); // v0 * 32 + v1
+  const __m256i quadWeights = _mm256_set1_epi32(0x00010400); // p0 << 10 | p1
+  // The 10 bytes of a lane big endian, lane 0 at 0-9 and lane 1 at 6-15
+  const __m256i gather = _mm256_setr_epi8(
+      4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8);
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4) {
+    __m256i valid;
+    __m256i values = base32_valuesAVX2(
+        _mm256_loadu_si256((const __m256i *)(src + g * BASE32_GROUP_CHARS)),
+        &valid);
+    if (-1 != _mm256_movemask_epi8(valid)) {
+      break;
+    }
+    __m256i quads = _mm256_madd_epi16(
+        _mm256_maddubs_epi16(values, pairWeights), quadWeights);
+    // Join the two 20 bit halves of every group into its 40 bits
+    __m256i group = _mm256_or_si256(_mm256_slli_epi64(quads, 20),
+                                    _mm256_srli_epi64(quads, 32));
+    __m256i bytes = _mm256_shuffle_epi8(group, gather);
+    // Store the second lane first, the first lane overwrites its 6 leading
+    // bytes and nothing is written behind the 20 bytes
+    uint8_t *out = decodedBytes + g * BASE32_GROUP_BYTES;
+    __m128i first = _mm256_castsi256_si128(bytes);
+    uint16_t last = (uint16_t)_mm_extract_epi16(first, 4);
+    _mm_storeu_si128((__m128i *)(out + 4), _mm256_extracti128_si256(bytes, 1));
+    _mm_storel_epi64((__m128i *)out, first);
+    memcpy(out + 8, &last, sizeof(last));
+  }
+  return g;
+}
+
+__attribute__((target("avx2"))) static size_t
+base32_encodeAVX2(char *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t groups,
+                  const char *characters)
+{
+  // Lane 0 holds bytes 0-15 with groups 0 and 1, lane 1 bytes 4-19 with
+  // groups 2 and 3 at 6 and 11
+  const __m256i firstWords =
+      _mm256_setr_epi8(BASE32_AVX2_WORDS(0), BASE32_AVX2_WORDS(6));
+  const __m256i secondWords =
+      _mm256_setr_epi8(BASE32_AVX2_WORDS(5), BASE32_AVX2_WORDS(11));
+  // Value i of a word starts at bit 11, 6, 9, 4, 7, 10, 5 or 8, the high
+  // half of the product with 2^(16 - shift) shifts it down
+  const __m256i shifts = _mm256_setr_epi16(
+      32, 1024, 128, 4096, 512, 64, 2048, 256, 32, 1024, 128, 4096, 512, 64,
+      2048, 256);
+  const __m256i valueMask = _mm256_set1_epi16(0x1F);
+  const __m256i lowChars = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i *)characters));
+  const __m256i highChars = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i *)(characters + 16)));
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4) {
+    const uint8_t *src = srcBytes + g * BASE32_GROUP_BYTES;
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)src)),
+        _mm_loadu_si128((const __m128i *)(src + 4)), 1);
+    __m256i first = _mm256_and_si256(
+        _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, firstWords), shifts),
+        valueMask);
+    __m256i second = _mm256_and_si256(
+        _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, secondWords), shifts),
+        valueMask);
+    // Packing per lane puts groups 0, 1 and 2, 3 into place
+    __m256i values = _mm256_packus_epi16(first, second);
+    __m256i chars = _mm256_blendv_epi8(
+        _mm256_shuffle_epi8(lowChars, values),
+        _mm256_shuffle_epi8(highChars, values),
+        _mm256_cmpgt_epi8(values, _mm256_set1_epi8(15)));
+    _mm256_storeu_si256((__m256i *)(encodedString + g * BASE32_GROUP_CHARS),
+                        chars);
+  }
+  return g;
+}
+#endif
@@ -0,0 +1,437 @@
+/**
+ * @file base64_converter.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Base64 byte converter with standard and URL safe alphabet.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "base64_converter.h"
+#include "baseX_cpu.h"
+
+#include <string.h>
+
+#ifdef BASEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define BASE64_INVALID (0x80) ///< Reverse table marker for invalid input
+#define BASE64_OPTIONS (BASE64_URL | BASE64_NOPAD) ///< All known options
+
+static const char base64_paddingCharacter = '='; ///< Padding character
+
+/**
+ * @brief Used base64 characters listed as an alphabet, indexed by
+ * BASE64_URL.
+ */
+static const char *base64_alphabets[2] = {
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"};
+
+#define IV BASE64_INVALID
+/**
+ * @brief Reverse lookup tables from an input character to its 6 bit value,
+ * indexed by BASE64_URL.
+ *
+ * Every byte which is not part of the alphabet (including the padding
+ * character) is marked with BASE64_INVALID.
+ */
+static const uint8_t base64_reverseTables[2][256] = {
+    {
+        // Standard alphabet
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, 62, IV, IV, IV, 63,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, IV, IV, IV, IV, IV, IV,
+        IV, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, IV, IV, IV, IV, IV,
+        IV, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    },
+    {
+        // URL safe alphabet
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, 62, IV, IV,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, IV, IV, IV, IV, IV, IV,
+        IV, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, IV, IV, IV, IV, 63,
+        IV, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+        IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV, IV,
+    },
+};
+#undef IV
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Encodes the bytes in blocks of 24 with AVX2.
+ *
+ * @param[out] encodedString Output buffer, 4 characters per 3 bytes.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] srcLength Number of input bytes.
+ * @param[in] url Use the URL safe alphabet.
+ * @return size_t Number of processed bytes (a multiple of 24).
+ */
+static size_t base64_encodeAVX2(char *encodedString,
+                                const uint8_t *srcBytes,
+                                size_t srcLength,
+                                uint8_t url);
+
+/**
+ * @brief Decodes the characters in blocks of 32 with AVX2.
+ *
+ * Stops at the first block containing an invalid character, which is then
+ * reported by the scalar loop.
+ *
+ * @param[out] decodedBytes Output buffer, 3 bytes per 4 characters.
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @param[in] url Use the URL safe alphabet.
+ * @return size_t Number of processed characters (a multiple of 32).
+ */
+static size_t base64_decodeAVX2(uint8_t *decodedBytes,
+                                const char *srcString,
+                                size_t srcLength,
+                                uint8_t url);
+#endif
+
+baseX_returnType base64_decodeString(uint8_t *decodedBytes,
+                                     size_t *decodedLength,
+                                     size_t decodedBytesSize,
+                                     const char *srcString,
+                                     uint8_t options)
+{
+  if (!srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  return base64_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                        srcString, strlen(srcString), options);
+}
+
+baseX_returnType base64_decodeN(uint8_t *decodedBytes,
+                                size_t *decodedLength,
+                                size_t decodedBytesSize,
+                                const char *srcString,
+                                size_t srcLength,
+                                uint8_t options)
+{
+  if (!decodedBytes || !decodedLength || !srcString ||
+      (options & ~BASE64_OPTIONS)) {
+    return BASEX_ARGUMENTS;
+  }
+  if (0 == srcLength) {
+    return BASEX_SRCERROR;
+  }
+
+  // Strip the padding, remaining padding characters are invalid input
+  size_t dataLength = srcLength;
+  if (!(options & BASE64_NOPAD)) {
+    if (srcLength % BASE64_GROUP_CHARS) {
+      return BASEX_SRCERROR;
+    }
+    for (uint8_t i = 0;
+         i < 2 && base64_paddingCharacter == srcString[dataLength - 1]; i++) {
+      dataLength--;
+    }
+  }
+  uint8_t tailLength = (uint8_t)(dataLength % BASE64_GROUP_CHARS);
+  if (1 == tailLength) {
+    return BASEX_SRCERROR; // A single character does not form a byte
+  }
+  size_t outputLength = dataLength / BASE64_GROUP_CHARS * BASE64_GROUP_BYTES +
+                        (tailLength ? tailLength - 1u : 0u);
+  *decodedLength = outputLength;
+  if (outputLength > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  const uint8_t url = options & BASE64_URL;
+  const uint8_t *table = base64_reverseTables[url];
+  const uint8_t *src = (const uint8_t *)srcString;
+  size_t rPos = 0;
+#ifdef BASEX_X86_SIMD
+  if (baseX_cpuFeatures() & BASEX_CPU_AVX2) {
+    rPos = base64_decodeAVX2(decodedBytes, srcString, dataLength, url);
+    decodedBytes += rPos / BASE64_GROUP_CHARS * BASE64_GROUP_BYTES;
+  }
+#endif
+
+  for (; rPos + BASE64_GROUP_CHARS <= dataLength;
+       rPos += BASE64_GROUP_CHARS) {
+    uint8_t a = table[src[rPos]];
+    uint8_t b = table[src[rPos + 1]];
+    uint8_t c = table[src[rPos + 2]];
+    uint8_t d = table[src[rPos + 3]];
+    if ((a | b | c | d) & BASE64_INVALID) {
+      return BASEX_SRCERROR;
+    }
+    uint32_t group = ((uint32_t)a << 18) | ((uint32_t)b << 12) |
+                     ((uint32_t)c << 6) | d;
+    *decodedBytes++ = (uint8_t)(group >> 16);
+    *decodedBytes++ = (uint8_t)(group >> 8);
+    *decodedBytes++ = (uint8_t)group;
+  }
+
+  if (tailLength) {
+    // 2 characters carry 1 byte and 3 characters carry 2 bytes
+    uint32_t group = 0;
+    uint8_t invalid = 0;
+    for (uint8_t i = 0; i < tailLength; i++) {
+      uint8_t value = table[src[rPos + i]];
+      invalid |= value;
+      group = (group << BASE64_BIT_LENGTH) | value;
+    }
+    if (invalid & BASE64_INVALID) {
+      return BASEX_SRCERROR;
+    }
+    group <<= BASE64_BIT_LENGTH * (BASE64_GROUP_CHARS - tailLength);
+    *decodedBytes++ = (uint8_t)(group >> 16);
+    if (3 == tailLength) {
+      *decodedBytes = (uint8_t)(group >> 8);
+    }
+  }
+  return BASEX_OK;
+}
+
+baseX_returnType base64_decodeInPlace(char *buffer,
+                                      size_t length,
+                                      size_t *decodedLength,
+                                      uint8_t options)
+{
+  if (!buffer) {
+    return BASEX_ARGUMENTS;
+  }
+  // The AVX2 kernel stores 24 bytes below the 32 characters it loaded
+  return base64_decodeN((uint8_t *)buffer, decodedLength, length, buffer,
+                        length, options);
+}
+
+baseX_returnType base64_encodeBytes(char *encodedString,
+                                    size_t encodedSize,
+                                    const uint8_t *srcBytes,
+                                    size_t srcLength,
+                                    uint8_t options)
+{
+  if (!encodedString || !srcBytes || (options & ~BASE64_OPTIONS)) {
+    return BASEX_ARGUMENTS;
+  }
+
+  uint8_t tailLength = (uint8_t)(srcLength % BASE64_GROUP_BYTES);
+  if (base64_encodedLength(srcLength, options) >= encodedSize) {
+    return BASEX_OVERFLOW; // +1 for null terminator
+  }
+
+  const uint8_t url = options & BASE64_URL;
+  const char *alphabet = base64_alphabets[url];
+  size_t i = 0;
+  char *out = encodedString;
+#ifdef BASEX_X86_SIMD
+  if (baseX_cpuFeatures() & BASEX_CPU_AVX2) {
+    i = base64_encodeAVX2(out, srcBytes, srcLength, url);
+    out += i / BASE64_GROUP_BYTES * BASE64_GROUP_CHARS;
+  }
+#endif
+
+  for (; i + BASE64_GROUP_BYTES <= srcLength; i += BASE64_GROUP_BYTES) {
+    uint32_t group = ((uint32_t)srcBytes[i] << 16) |
+                     ((uint32_t)srcBytes[i + 1] << 8) | srcBytes[i + 2];
+    *out++ = alphabet[(group >> 18) & 0x3F];
+    *out++ = alphabet[(group >> 12) & 0x3F];
+    *out++ = alphabet[(group >> 6) & 0x3F];
+    *out++ = alphabet[group & 0x3F];
+  }
+
+  if (tailLength) {
+    uint32_t group = (uint32_t)srcBytes[i] << 16;
+    if (2 == tailLength) {
+      group |= (uint32_t)srcBytes[i + 1] << 8;
+    }
+    *out++ = alphabet[(group >> 18) & 0x3F];
+    *out++ = alphabet[(group >> 12) & 0x3F];
+    if (2 == tailLength) {
+      *out++ = alphabet[(group >> 6) & 0x3F];
+    }
+    // Padding
+    while (!(options & BASE64_NOPAD) &&
+           (size_t)(out - encodedString) % BASE64_GROUP_CHARS) {
+      *out++ = base64_paddingCharacter;
+    }
+  }
+  *out = '\0';
+  return BASEX_OK;
+}
+
+size_t base64_encodedLength(size_t srcLength, uint8_t options)
+{
+  size_t groups = srcLength / BASE64_GROUP_BYTES;
+  uint8_t tailLength = (uint8_t)(srcLength % BASE64_GROUP_BYTES);
+  if (groups > SIZE_MAX / BASE64_GROUP_CHARS - 1) {
+    return SIZE_MAX; // Output length not representable
+  }
+  size_t outputLength = groups * BASE64_GROUP_CHARS;
+  if (tailLength) {
+    outputLength += (options & BASE64_NOPAD) ? tailLength + 1u
+                                             : BASE64_GROUP_CHARS;
+  }
+  return outputLength;
+}
+
+size_t base64_maxDecodedLength(size_t srcLength)
+{
+  return BASE64_MAX_DECODED_LENGTH(srcLength);
+}
+
+size_t base64_decodedLength(const char *srcString, size_t srcLength)
+{
+  // At most 2 padding characters follow the data of the last group
+  for (uint8_t i = 0; i < 2 && srcLength &&
+                      base64_paddingCharacter == srcString[srcLength - 1];
+       i++) {
+    srcLength--;
+  }
+  return BASE64_MAX_DECODED_LENGTH(srcLength);
+}
+
+#ifdef BASEX_X86_SIMD
+__attribute__((target("avx2"))) static size_t
+base64_encodeAVX2(char *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t srcLength,
+                  uint8_t url)
+{
+  // Spread 3 bytes onto 4 byte lanes: lane bytes [b1, b0, b2, b1]
+  const __m256i spread = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  // Offsets from the 6 bit value to the character, indexed by value class:
+  // 0: A-Z, 1: a-z, 2-11: 0-9, 12: value 62, 13: value 63
+  const char char62 = url ? '-' : '+';
+  const char char63 = url ? '_' : '/';
+  const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+      'A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, (char)(char62 - 62),
+      (char)(char63 - 63), 0, 0));
+
+  size_t i = 0;
+  // Each lane reads 16 bytes and uses 12 of them
+  for (; i + 28 <= srcLength; i += 24) {
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128((const __m128i *)(srcBytes + i))),
+        _mm_loadu_si128((const __m128i *)(srcBytes + i + 12)), 1);
+    in = _mm256_shuffle_epi8(in, spread);
+
+    // Move the 4 6-bit fields of every 32 bit lane into separate bytes
+    __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+    __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+    __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    __m256i values = _mm256_or_si256(t1, t3);
+
+    // Translate the values into characters
+    __m256i index = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+    index = _mm256_sub_epi8(
+        index, _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+    __m256i out =
+        _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, index));
+    _mm256_storeu_si256(
+        (__m256i *)(encodedString + i / BASE64_GROUP_BYTES * BASE64_GROUP_CHARS),
+        out);
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+base64_decodeAVX2(uint8_t *decodedBytes,
+                  const char *srcString,
+                  size_t srcLength,
+                  uint8_t url)
+{
+  // A character is valid if the entries of its low and high nibble have no
+  // common bit. The high nibble classes are 0x01 for '+' and '/' or '-',
+  // 0x02 for the digits, 0x04 for A-O and a-o, 0x08 for P-Z and 0x20 for
+  // p-z. Every other high nibble is invalid (0x10).
+  const __m256i lutLow = _mm256_broadcastsi128_si256(
+      url ? _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33)
+          : _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x3A, 0x3B, 0x3B, 0x3B, 0x3A));
+  const __m256i lutHigh = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10,
+                    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+  // Offset from the character to its value, indexed by the high nibble. The
+  // value 63 character shares its high nibble and gets its own offset.
+  const char char62 = url ? '-' : '+';
+  const char char63 = url ? '_' : '/';
+  const __m256i lutShift = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0, 0, (char)(62 - char62), 52 - '0', -'A', -'A', 26 - 'a',
+                    26 - 'a', 0, 0, 0, 0, 0, 0, 0, 0));
+  const __m256i match63 = _mm256_set1_epi8(char63);
+  const __m256i shift63 = _mm256_set1_epi8((char)(63 - char63));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m256i in = _mm256_loadu_si256((const __m256i *)(srcString + i));
+    __m256i high = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble);
+    __m256i low = _mm256_and_si256(in, nibble);
+    // Bytes >= 0x80 select the 0x10 class through their high nibble
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lutLow, low),
+                            _mm256_shuffle_epi8(lutHigh, high))) {
+      break;
+    }
+    __m256i shift = _mm256_blendv_epi8(_mm256_shuffle_epi8(lutShift, high),
+                                       shift63,
+                                       _mm256_cmpeq_epi8(in, match63));
+    __m256i values = _mm256_add_epi8(in, shift);
+
+    // Merge 4 6-bit values into 3 bytes per 32 bit lane
+    __m256i merged =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(
+        merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1,
+                                 -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                 13, 12, -1, -1, -1, -1));
+    merged = _mm256_permutevar8x32_epi32(
+        merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+    // Store exactly 24 bytes to not write behind the output
+    uint8_t *out = decodedBytes + i / BASE64_GROUP_CHARS * BASE64_GROUP_BYTES;
+    _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(merged));
+    _mm_storel_epi64((__m128i *)(out + 16),
+                     _mm256_extracti128_si256(merged, 1));
+  }
+  return i;
+}
+#endif
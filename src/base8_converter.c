@@ -29,8 +29,24 @@
  */
 
 #include "base8_converter.h"
+#include "baseX_cpu.h"
+
 #include <string.h>
 
+#ifdef BASEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define BASE8_DIGIT_MASK (0x0707070707070707ull) ///< 3 bit digit per byte
+#define BASE8_CHAR_OFFSET (0x3131313131313131ull) ///< '1' in every byte
+
+#ifdef BASEX_X86_SIMD
+/// Big endian 16 bit words holding the 8 digits of the group at byte o
+#define BASE8_SIMD_WORDS(o)                                                    \
+  (o) + 1, (o), (o) + 1, (o), (o) + 1, (o), (o) + 2, (o) + 1, (o) + 2,         \
+      (o) + 1, (o) + 2, (o) + 1, -1, (o) + 2, -1, (o) + 2
+#endif
+
 const uint8_t baseNumberOfBits[8] = {
     0, // 000
     1, // 001
@@ -42,25 +58,219 @@ const uint8_t baseNumberOfBits[8] = {
     3, // 111
 };
 
+/**
+ * @brief Encodes complete 3 byte groups into 8 base8 characters each.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per group.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] groups Number of groups to encode.
+ * @param[in,out] numberOfBits Set bits of the emitted characters.
+ */
+static void base8_encodeGroups(uint8_t *encodedString,
+                               const uint8_t *srcBytes,
+                               size_t groups,
+                               uint32_t *numberOfBits);
+
+/**
+ * @brief Decodes one complete group of 8 numbers into 3 bytes.
+ *
+ * @param[out] decodedBytes Output buffer for the 3 bytes.
+ * @param[in] numbers The 8 base8 numbers (0-7).
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ */
+static void base8_decodeGroup(uint8_t *decodedBytes,
+                              const uint8_t *numbers,
+                              uint32_t *numberOfBits);
+
+/**
+ * @brief Validates and decodes one complete group of 8 characters into 3
+ * bytes.
+ *
+ * @param[out] decodedBytes Output buffer for the 3 bytes.
+ * @param[in] srcString The 8 base8 characters ('1'-'8').
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ * @return baseX_returnType BASEX_SRCERROR on an invalid character.
+ */
+static baseX_returnType base8_decodeChars(uint8_t *decodedBytes,
+                                          const char *srcString,
+                                          uint32_t *numberOfBits);
+
+/**
+ * @brief Decodes an incomplete group of 3 or 6 numbers and verifies its
+ * check number.
+ *
+ * @param[out] decodedBytes Output buffer for the 1 or 2 bytes.
+ * @param[in] numbers The base8 numbers (0-7), the last one holds the check
+ * number.
+ * @param[in] length Number of numbers, 3 or 6.
+ * @param[in] numberOfBits Set bits of all numbers before this group.
+ * @return baseX_returnType BASEX_SRCERROR on a wrong check number.
+ */
+static baseX_returnType base8_decodeTail(uint8_t *decodedBytes,
+                                         const uint8_t *numbers,
+                                         uint8_t length,
+                                         uint32_t numberOfBits);
+
+/**
+ * @brief Decodes complete groups of 8 numbers with the fastest available
+ * kernel.
+ *
+ * Stops at the first group containing a number above 7, which is then
+ * handled by the scalar code.
+ *
+ * @param[out] decodedBytes Output buffer, 3 bytes per group.
+ * @param[in] srcNumbers Input characters or numbers.
+ * @param[in] groups Number of groups to decode.
+ * @param[in] offset Value of the number 0, BASE8_STARTCHAR for characters.
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ * @return size_t Number of decoded groups.
+ */
+static size_t base8_decodeGroups(uint8_t *decodedBytes,
+                                 const uint8_t *srcNumbers,
+                                 size_t groups,
+                                 uint8_t offset,
+                                 uint32_t *numberOfBits);
+
+#ifdef BASEX_X86_BMI2
+/**
+ * @brief Encodes complete 3 byte groups with BMI2, PDEP scatters the 24 bits
+ * of a group into 8 bytes.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per group.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] groups Number of groups to encode.
+ * @param[in,out] numberOfBits Set bits of the emitted characters.
+ */
+static void base8_encodeBMI2(uint8_t *encodedString,
+                             const uint8_t *srcBytes,
+                             size_t groups,
+                             uint32_t *numberOfBits);
+
+/**
+ * @brief Decodes complete groups of 8 characters with BMI2, PEXT gathers the
+ * 8 digits of a group into 24 bits.
+ *
+ * Stops at the first group containing an invalid character, which is then
+ * reported by the scalar code.
+ *
+ * @param[out] decodedBytes Output buffer, 3 bytes per group.
+ * @param[in] srcString Input characters.
+ * @param[in] groups Number of groups to decode.
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ * @return size_t Number of decoded groups.
+ */
+static size_t base8_decodeBMI2(uint8_t *decodedBytes,
+                               const char *srcString,
+                               size_t groups,
+                               uint32_t *numberOfBits);
+#endif
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Checks the digits and counts their set bits in blocks of 16 with
+ * SSE4.1.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @param[in,out] numberOfBits Set bits of the checked digits.
+ * @return size_t Position of the first invalid character, or the number of
+ * checked characters (a multiple of 16) if there is none.
+ */
+static size_t base8_validateSSE41(const char *srcString,
+                                  size_t srcLength,
+                                  uint32_t *numberOfBits);
+
+/**
+ * @brief Checks the digits and counts their set bits in blocks of 32 with
+ * AVX2.
+ *
+ * @param[in] srcString Input characters.
+ * @param[in] srcLength Number of input characters.
+ * @param[in,out] numberOfBits Set bits of the checked digits.
+ * @return size_t Position of the first invalid character, or the number of
+ * checked characters (a multiple of 32) if there is none.
+ */
+static size_t base8_validateAVX2(const char *srcString,
+                                 size_t srcLength,
+                                 uint32_t *numberOfBits);
+
+/**
+ * @brief Encodes blocks of 4 groups (12 bytes to 32 characters) with SSE4.1.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per group.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] groups Number of groups available.
+ * @param[in,out] numberOfBits Set bits of the emitted characters.
+ * @return size_t Number of encoded groups, a multiple of 4.
+ */
+static size_t base8_encodeSSE41(uint8_t *encodedString,
+                                const uint8_t *srcBytes,
+                                size_t groups,
+                                uint32_t *numberOfBits);
+
+/**
+ * @brief Encodes blocks of 4 groups (12 bytes to 32 characters) with AVX2.
+ *
+ * @param[out] encodedString Output buffer, 8 characters per group.
+ * @param[in] srcBytes Input bytes.
+ * @param[in] groups Number of groups available.
+ * @param[in,out] numberOfBits Set bits of the emitted characters.
+ * @return size_t Number of encoded groups, a multiple of 4.
+ */
+static size_t base8_encodeAVX2(uint8_t *encodedString,
+                               const uint8_t *srcBytes,
+                               size_t groups,
+                               uint32_t *numberOfBits);
+
+/**
+ * @brief Decodes blocks of 2 groups (16 numbers to 6 bytes) with SSE4.1.
+ *
+ * Stops at the first block containing a number above 7.
+ *
+ * @param[out] decodedBytes Output buffer, 3 bytes per group.
+ * @param[in] srcNumbers Input characters or numbers.
+ * @param[in] groups Number of groups available.
+ * @param[in] offset Value of the number 0.
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ * @return size_t Number of decoded groups, a multiple of 2.
+ */
+static size_t base8_decodeSSE41(uint8_t *decodedBytes,
+                                const uint8_t *srcNumbers,
+                                size_t groups,
+                                uint8_t offset,
+                                uint32_t *numberOfBits);
+
+/**
+ * @brief Decodes blocks of 4 groups (32 numbers to 12 bytes) with AVX2.
+ *
+ * Stops at the first block containing a number above 7.
+ *
+ * @param[out] decodedBytes Output buffer, 3 bytes per group.
+ * @param[in] srcNumbers Input characters or numbers.
+ * @param[in] groups Number of groups available.
+ * @param[in] offset Value of the number 0.
+ * @param[in,out] numberOfBits Set bits of the decoded numbers.
+ * @return size_t Number of decoded groups, a multiple of 4.
+ */
+static size_t base8_decodeAVX2(uint8_t *decodedBytes,
+                               const uint8_t *srcNumbers,
+                               size_t groups,
+                               uint8_t offset,
+                               uint32_t *numberOfBits);
+#endif
+
 baseX_returnType base8_encodeBytes(uint8_t *encodedString,
-                                   uint32_t encodedStringSize,
+                                   size_t encodedStringSize,
                                    const uint8_t *srcBytes,
-                                   uint32_t srcBytesSize)
+                                   size_t srcBytesSize)
 {
   if (NULL == encodedString || NULL == srcBytes) {
     return BASEX_ARGUMENTS;
   }
 
-  // Check needed length
-  uint32_t outputLength =
-      srcBytesSize * BASEX_BYTE_BIT_LENGTH / BASE8_BIT_LENGTH;
-
   uint8_t checkBits = (uint8_t)(srcBytesSize % BASE8_BIT_LENGTH);
-  if (checkBits) {
-    outputLength++;
-  }
   // Check overflow
-  if (outputLength >= encodedStringSize) {
+  if (base8_encodedLength(srcBytesSize) >= encodedStringSize) {
     return BASEX_OVERFLOW;
   }
 
@@ -68,9 +278,14 @@ baseX_returnType base8_encodeBytes(uint8_t *encodedString,
   uint16_t carryLength = 0;
   uint32_t numberOfBits = 0;
 
-  uint32_t outPos = 0;
+  // The carry is empty after every complete group, the loop below only
+  // encodes the 1 or 2 remaining bytes
+  size_t groups = srcBytesSize / BASE8_GROUP_BYTES;
+  base8_encodeGroups(encodedString, srcBytes, groups, &numberOfBits);
+  size_t srcPos = groups * BASE8_GROUP_BYTES;
+  size_t outPos = groups * BASE8_GROUP_CHARS;
 
-  for (uint32_t srcPos = 0; srcPos < srcBytesSize; srcPos++) {
+  for (; srcPos < srcBytesSize; srcPos++) {
     carry += (uint16_t)((uint16_t)(srcBytes[srcPos])
                         << (BASEX_BYTE_BIT_LENGTH - carryLength));
     for (uint8_t i = 0; i < (2 + (carryLength ? 1 : 0)); i++) {
@@ -97,17 +312,48 @@ baseX_returnType base8_encodeBytes(uint8_t *encodedString,
   return BASEX_OK;
 }
 
+size_t base8_encodedLength(size_t srcLength)
+{
+  // 8 characters per full group and 3 or 6 characters for an incomplete
+  // group
+  size_t groups = srcLength / BASE8_GROUP_BYTES;
+  if (groups > (SIZE_MAX - 2 * BASE8_BIT_LENGTH) / BASE8_GROUP_CHARS) {
+    return SIZE_MAX; // Output length not representable
+  }
+  return BASE8_ENCODED_LENGTH(srcLength);
+}
+
+size_t base8_maxDecodedLength(size_t srcLength)
+{
+  return BASE8_MAX_DECODED_LENGTH(srcLength);
+}
+
+size_t base8_decodedLength(const char *srcString, size_t srcLength)
+{
+  (void)srcString;
+  return BASE8_MAX_DECODED_LENGTH(srcLength);
+}
+
 baseX_returnType base8_stringToNum(uint8_t *number, const char *srcString)
+{
+  if (NULL == srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  return base8_stringToNumN(number, srcString, strlen(srcString));
+}
+
+baseX_returnType base8_stringToNumN(uint8_t *number,
+                                    const char *srcString,
+                                    size_t srcLength)
 {
   if (NULL == number || NULL == srcString) {
     return BASEX_ARGUMENTS;
   }
-  uint32_t srcLength = (uint32_t)strlen(srcString);
   if (0 == srcLength) {
     return BASEX_ARGUMENTS;
   }
 
-  for (uint32_t i = 0; i < srcLength; i++) {
+  for (size_t i = 0; i < srcLength; i++) {
     if (srcString[i] < BASE8_STARTCHAR || srcString[i] > BASE8_ENDCHAR) {
       return BASEX_SRCERROR;
     } else {
@@ -117,11 +363,135 @@ baseX_returnType base8_stringToNum(uint8_t *number, const char *srcString)
   return BASEX_OK;
 }
 
+baseX_returnType base8_decodeString(uint8_t *decodedBytes,
+                                    size_t *decodedLength,
+                                    size_t decodedBytesSize,
+                                    const char *srcString)
+{
+  if (NULL == srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  return base8_decodeN(decodedBytes, decodedLength, decodedBytesSize,
+                       srcString, strlen(srcString));
+}
+
+baseX_returnType base8_decodeN(uint8_t *decodedBytes,
+                               size_t *decodedLength,
+                               size_t decodedBytesSize,
+                               const char *srcString,
+                               size_t srcLength)
+{
+  if (NULL == decodedBytes || NULL == decodedLength || NULL == srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  // An incomplete group has 3 or 6 characters
+  uint8_t tailLength = (uint8_t)(srcLength % BASE8_GROUP_CHARS);
+  if (0 == srcLength || 0 != (tailLength % BASE8_BIT_LENGTH)) {
+    return BASEX_SRCERROR;
+  }
+  size_t outputLength = base8_maxDecodedLength(srcLength);
+  if (outputLength > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  uint32_t numberOfBits = 0;
+  size_t groups = srcLength / BASE8_GROUP_CHARS;
+  size_t i = base8_decodeGroups(decodedBytes, (const uint8_t *)srcString,
+                                groups, BASE8_STARTCHAR, &numberOfBits);
+  for (; i < groups; i++) {
+    if (BASEX_OK != base8_decodeChars(decodedBytes + i * BASE8_GROUP_BYTES,
+                                      srcString + i * BASE8_GROUP_CHARS,
+                                      &numberOfBits)) {
+      return BASEX_SRCERROR;
+    }
+  }
+
+  if (tailLength) {
+    uint8_t numbers[BASE8_GROUP_CHARS];
+    const char *tail = srcString + groups * BASE8_GROUP_CHARS;
+    for (uint8_t i = 0; i < tailLength; i++) {
+      if (tail[i] < BASE8_STARTCHAR || tail[i] > BASE8_ENDCHAR) {
+        return BASEX_SRCERROR;
+      }
+      numbers[i] = (uint8_t)tail[i] - BASE8_STARTCHAR;
+    }
+    if (BASEX_OK != base8_decodeTail(decodedBytes +
+                                         groups * BASE8_GROUP_BYTES,
+                                     numbers, tailLength, numberOfBits)) {
+      return BASEX_SRCERROR;
+    }
+  }
+  *decodedLength = outputLength;
+  return BASEX_OK;
+}
+
+baseX_returnType base8_decodeInPlace(char *buffer,
+                                     size_t length,
+                                     size_t *decodedLength)
+{
+  if (NULL == buffer) {
+    return BASEX_ARGUMENTS;
+  }
+  // 3 bytes are written after their 8 characters have been read
+  return base8_decodeN((uint8_t *)buffer, decodedLength, length, buffer,
+                       length);
+}
+
+baseX_returnType base8_validate(const char *srcString,
+                                size_t srcLength,
+                                size_t *errorOffset)
+{
+  if (NULL == srcString) {
+    return BASEX_ARGUMENTS;
+  }
+  uint8_t tailLength = (uint8_t)(srcLength % BASE8_GROUP_CHARS);
+  // The last character of an incomplete group holds the check number
+  size_t digits = tailLength ? srcLength - 1 : srcLength;
+  uint32_t numberOfBits = 0;
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    i = base8_validateAVX2(srcString, digits, &numberOfBits);
+  } else if (features & BASEX_CPU_SSE41) {
+    i = base8_validateSSE41(srcString, digits, &numberOfBits);
+  }
+#endif
+  for (; i < digits; i++) {
+    // Characters below '1' wrap around and are caught as well
+    uint8_t number = (uint8_t)((uint8_t)srcString[i] - BASE8_STARTCHAR);
+    if (number > 0x07) {
+      break;
+    }
+    numberOfBits += baseNumberOfBits[number];
+  }
+
+  if (i == digits && digits < srcLength) {
+    uint8_t number = (uint8_t)((uint8_t)srcString[i] - BASE8_STARTCHAR);
+    uint8_t checkBits = tailLength / BASE8_BIT_LENGTH;
+    if (number > 0x07) {
+      // Invalid check number character
+    } else if (tailLength % BASE8_BIT_LENGTH) {
+      i = srcLength; // Not allowed length
+    } else if ((number & ((1u << checkBits) - 1)) ==
+               numberOfBits % (2u * checkBits)) {
+      i = srcLength;
+    }
+  }
+  if (i == srcLength && srcLength && !(tailLength % BASE8_BIT_LENGTH)) {
+    return BASEX_OK;
+  }
+  if (errorOffset) {
+    *errorOffset = i;
+  }
+  return BASEX_SRCERROR;
+}
+
 baseX_returnType base8_decodeNum(uint8_t *decodedBytes,
-                                 uint32_t *decodedLength,
-                                 uint32_t decodedBytesSize,
+                                 size_t *decodedLength,
+                                 size_t decodedBytesSize,
                                  const uint8_t *srcNumbers,
-                                 const uint32_t srcLength)
+                                 const size_t srcLength)
 {
 
 #define NO_CHECK_BYTES (8)
@@ -137,8 +507,8 @@ baseX_returnType base8_decodeNum(uint8_t *decodedBytes,
   }
   // Set outputlength and check overflow
 
-  uint32_t outputLength = (srcLength / NO_CHECK_BYTES * BASE8_BIT_LENGTH) +
-                          realBytes / BASE8_BIT_LENGTH;
+  size_t outputLength = (srcLength / NO_CHECK_BYTES * BASE8_BIT_LENGTH) +
+                        realBytes / BASE8_BIT_LENGTH;
 
   uint8_t checkBits = realBytes / BASE8_BIT_LENGTH;
 
@@ -147,13 +517,20 @@ baseX_returnType base8_decodeNum(uint8_t *decodedBytes,
   }
 
   // Run algorithm
-  uint32_t srcPos = 0;
-  uint32_t outPos = 0;
+  size_t srcPos = 0;
+  size_t outPos = 0;
   uint16_t carry = 0;
   uint8_t carryLength = 0;
   uint32_t numberOfBits = 0;
   uint8_t lastBitNumber = 0;
 
+  // The carry is empty after every complete group
+  size_t groups = base8_decodeGroups(decodedBytes, srcNumbers,
+                                     srcLength / NO_CHECK_BYTES, 0,
+                                     &numberOfBits);
+  srcPos = groups * NO_CHECK_BYTES;
+  outPos = groups * BASE8_GROUP_BYTES;
+
   for (; outPos < outputLength; outPos++) {
     for (uint8_t i = 0; i < (BASE8_BIT_LENGTH - carryLength / 2);
          i++, srcPos++) {
@@ -174,4 +551,658 @@ baseX_returnType base8_decodeNum(uint8_t *decodedBytes,
     }
   }
   return BASEX_OK;
-}
\ No newline at end of file
+}
+
+baseX_returnType base8_encodeInit(base8_encodeContext *ctx)
+{
+  if (NULL == ctx) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
+
+baseX_returnType base8_encodeUpdate(base8_encodeContext *ctx,
+                                    uint8_t *encodedString,
+                                    size_t encodedStringSize,
+                                    size_t *encodedLength,
+                                    const uint8_t *srcBytes,
+                                    size_t srcBytesSize)
+{
+  if (NULL == ctx || NULL == encodedString || NULL == encodedLength ||
+      (NULL == srcBytes && srcBytesSize)) {
+    return BASEX_ARGUMENTS;
+  }
+  if ((ctx->groupLength + srcBytesSize) / BASE8_GROUP_BYTES >
+      encodedStringSize / BASE8_GROUP_CHARS) {
+    return BASEX_OVERFLOW;
+  }
+
+  size_t outPos = 0;
+  // Complete the pending group first
+  if (ctx->groupLength) {
+    while (ctx->groupLength < BASE8_GROUP_BYTES && srcBytesSize) {
+      ctx->group[ctx->groupLength++] = *srcBytes++;
+      srcBytesSize--;
+    }
+    if (ctx->groupLength < BASE8_GROUP_BYTES) {
+      *encodedLength = 0;
+      return BASEX_OK;
+    }
+    base8_encodeGroups(encodedString, ctx->group, 1, &ctx->numberOfBits);
+    outPos += BASE8_GROUP_CHARS;
+    ctx->groupLength = 0;
+  }
+
+  size_t groups = srcBytesSize / BASE8_GROUP_BYTES;
+  base8_encodeGroups(encodedString + outPos, srcBytes, groups,
+                     &ctx->numberOfBits);
+  outPos += groups * BASE8_GROUP_CHARS;
+  srcBytes += groups * BASE8_GROUP_BYTES;
+  srcBytesSize -= groups * BASE8_GROUP_BYTES;
+
+  while (srcBytesSize--) {
+    ctx->group[ctx->groupLength++] = *srcBytes++;
+  }
+  *encodedLength = outPos;
+  return BASEX_OK;
+}
+
+baseX_returnType base8_encodeFinal(base8_encodeContext *ctx,
+                                   uint8_t *encodedString,
+                                   size_t encodedStringSize,
+                                   size_t *encodedLength)
+{
+  if (NULL == ctx || NULL == encodedString || NULL == encodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  uint8_t checkBits = ctx->groupLength;
+  if (0 == checkBits) {
+    *encodedLength = 0;
+    return BASEX_OK;
+  }
+  // 1 byte needs 3 characters and 2 bytes need 6 characters
+  size_t outputLength = (size_t)checkBits * BASE8_BIT_LENGTH;
+  if (outputLength > encodedStringSize) {
+    return BASEX_OVERFLOW;
+  }
+
+  uint32_t group = (uint32_t)ctx->group[0] << 16;
+  if (2 == checkBits) {
+    group |= (uint32_t)ctx->group[1] << 8;
+  }
+  uint8_t shift = 24;
+  for (size_t i = 0; i < outputLength - 1; i++) {
+    shift = (uint8_t)(shift - BASE8_BIT_LENGTH);
+    uint8_t number = (uint8_t)((group >> shift) & 0x07);
+    ctx->numberOfBits += baseNumberOfBits[number];
+    encodedString[i] = number + BASE8_STARTCHAR;
+  }
+  // The last character carries the remaining bits and the check bits
+  shift = (uint8_t)(shift - BASE8_BIT_LENGTH);
+  encodedString[outputLength - 1] =
+      (uint8_t)(((group >> shift) & 0x07) +
+                (ctx->numberOfBits % (2 * checkBits)) + BASE8_STARTCHAR);
+  ctx->groupLength = 0;
+  *encodedLength = outputLength;
+  return BASEX_OK;
+}
+
+baseX_returnType base8_decodeInit(base8_decodeContext *ctx)
+{
+  if (NULL == ctx) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  return BASEX_OK;
+}
+
+baseX_returnType base8_decodeUpdate(base8_decodeContext *ctx,
+                                    uint8_t *decodedBytes,
+                                    size_t decodedBytesSize,
+                                    size_t *decodedLength,
+                                    const char *srcString,
+                                    size_t srcLength)
+{
+  if (NULL == ctx || NULL == decodedBytes || NULL == decodedLength ||
+      (NULL == srcString && srcLength)) {
+    return BASEX_ARGUMENTS;
+  }
+  if ((ctx->groupLength + srcLength) / BASE8_GROUP_CHARS >
+      decodedBytesSize / BASE8_GROUP_BYTES) {
+    return BASEX_OVERFLOW;
+  }
+
+  size_t outPos = 0;
+  for (size_t i = 0; i < srcLength; i++) {
+    if (0 == ctx->groupLength) {
+      // Decode complete groups directly from the input
+      size_t groups = base8_decodeGroups(
+          decodedBytes + outPos, (const uint8_t *)srcString + i,
+          (srcLength - i) / BASE8_GROUP_CHARS, BASE8_STARTCHAR,
+          &ctx->numberOfBits);
+      outPos += groups * BASE8_GROUP_BYTES;
+      i += groups * BASE8_GROUP_CHARS;
+      for (; srcLength - i >= BASE8_GROUP_CHARS; i += BASE8_GROUP_CHARS) {
+        if (BASEX_OK != base8_decodeChars(decodedBytes + outPos,
+                                          srcString + i,
+                                          &ctx->numberOfBits)) {
+          return BASEX_SRCERROR;
+        }
+        outPos += BASE8_GROUP_BYTES;
+      }
+      if (i == srcLength) {
+        break;
+      }
+    }
+    if (srcString[i] < BASE8_STARTCHAR || srcString[i] > BASE8_ENDCHAR) {
+      return BASEX_SRCERROR;
+    }
+    ctx->group[ctx->groupLength++] = (uint8_t)srcString[i] - BASE8_STARTCHAR;
+    if (BASE8_GROUP_CHARS == ctx->groupLength) {
+      base8_decodeGroup(decodedBytes + outPos, ctx->group,
+                        &ctx->numberOfBits);
+      outPos += BASE8_GROUP_BYTES;
+      ctx->groupLength = 0;
+    }
+  }
+  if (srcLength) {
+    ctx->started = 1;
+  }
+  *decodedLength = outPos;
+  return BASEX_OK;
+}
+
+baseX_returnType base8_decodeFinal(base8_decodeContext *ctx,
+                                   uint8_t *decodedBytes,
+                                   size_t decodedBytesSize,
+                                   size_t *decodedLength)
+{
+  if (NULL == ctx || NULL == decodedBytes || NULL == decodedLength) {
+    return BASEX_ARGUMENTS;
+  }
+  if (!ctx->started || 0 != (ctx->groupLength % BASE8_BIT_LENGTH)) {
+    return BASEX_SRCERROR;
+  }
+  uint8_t checkBits = ctx->groupLength / BASE8_BIT_LENGTH;
+  if (checkBits > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+  *decodedLength = checkBits;
+  if (0 == checkBits) {
+    return BASEX_OK;
+  }
+
+  uint8_t groupLength = ctx->groupLength;
+  ctx->groupLength = 0;
+  return base8_decodeTail(decodedBytes, ctx->group, groupLength,
+                          ctx->numberOfBits);
+}
+
+static void base8_encodeGroups(uint8_t *encodedString,
+                               const uint8_t *srcBytes,
+                               size_t groups,
+                               uint32_t *numberOfBits)
+{
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  size_t done = 0;
+  if (features & BASEX_CPU_AVX2) {
+    done = base8_encodeAVX2(encodedString, srcBytes, groups, numberOfBits);
+  } else if (features & BASEX_CPU_SSE41) {
+    done = base8_encodeSSE41(encodedString, srcBytes, groups, numberOfBits);
+  }
+  encodedString += done * BASE8_GROUP_CHARS;
+  srcBytes += done * BASE8_GROUP_BYTES;
+  groups -= done;
+#ifdef BASEX_X86_BMI2
+  if (features & BASEX_CPU_BMI2) {
+    base8_encodeBMI2(encodedString, srcBytes, groups, numberOfBits);
+    return;
+  }
+#endif
+#endif
+  uint32_t bits = *numberOfBits;
+  for (size_t g = 0; g < groups; g++) {
+    uint32_t group = ((uint32_t)srcBytes[0] << 16) |
+                     ((uint32_t)srcBytes[1] << 8) | srcBytes[2];
+    for (int8_t shift = 21; shift >= 0; shift -= BASE8_BIT_LENGTH) {
+      uint8_t number = (uint8_t)((group >> shift) & 0x07);
+      bits += baseNumberOfBits[number];
+      *encodedString++ = number + BASE8_STARTCHAR;
+    }
+    srcBytes += BASE8_GROUP_BYTES;
+  }
+  *numberOfBits = bits;
+}
+
+static size_t base8_decodeGroups(uint8_t *decodedBytes,
+                                 const uint8_t *srcNumbers,
+                                 size_t groups,
+                                 uint8_t offset,
+                                 uint32_t *numberOfBits)
+{
+  size_t done = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    done = base8_decodeAVX2(decodedBytes, srcNumbers, groups, offset,
+                            numberOfBits);
+  } else if (features & BASEX_CPU_SSE41) {
+    done = base8_decodeSSE41(decodedBytes, srcNumbers, groups, offset,
+                             numberOfBits);
+  }
+#ifdef BASEX_X86_BMI2
+  // The BMI2 kernel only checks the character range
+  if ((features & BASEX_CPU_BMI2) && BASE8_STARTCHAR == offset) {
+    done += base8_decodeBMI2(decodedBytes + done * BASE8_GROUP_BYTES,
+                             (const char *)srcNumbers +
+                                 done * BASE8_GROUP_CHARS,
+                             groups - done, numberOfBits);
+  }
+#endif
+#else
+  (void)decodedBytes;
+  (void)srcNumbers;
+  (void)groups;
+  (void)offset;
+  (void)numberOfBits;
+#endif
+  return done;
+}
+
+static void base8_decodeGroup(uint8_t *decodedBytes,
+                              const uint8_t *numbers,
+                              uint32_t *numberOfBits)
+{
+  uint32_t group = 0;
+  for (uint8_t i = 0; i < BASE8_GROUP_CHARS; i++) {
+    group = (group << BASE8_BIT_LENGTH) | numbers[i];
+    *numberOfBits += baseNumberOfBits[numbers[i]];
+  }
+  decodedBytes[0] = (uint8_t)(group >> 16);
+  decodedBytes[1] = (uint8_t)(group >> 8);
+  decodedBytes[2] = (uint8_t)group;
+}
+
+static baseX_returnType base8_decodeChars(uint8_t *decodedBytes,
+                                          const char *srcString,
+                                          uint32_t *numberOfBits)
+{
+  uint32_t group = 0;
+  uint8_t invalid = 0;
+  for (uint8_t i = 0; i < BASE8_GROUP_CHARS; i++) {
+    // Characters below '1' wrap around and are caught as well
+    uint8_t number = (uint8_t)((uint8_t)srcString[i] - BASE8_STARTCHAR);
+    invalid |= number;
+    number &= 0x07;
+    group = (group << BASE8_BIT_LENGTH) | number;
+    *numberOfBits += baseNumberOfBits[number];
+  }
+  if (invalid & (uint8_t)~0x07) {
+    return BASEX_SRCERROR;
+  }
+  decodedBytes[0] = (uint8_t)(group >> 16);
+  decodedBytes[1] = (uint8_t)(group >> 8);
+  decodedBytes[2] = (uint8_t)group;
+  return BASEX_OK;
+}
+
+static baseX_returnType base8_decodeTail(uint8_t *decodedBytes,
+                                         const uint8_t *numbers,
+                                         uint8_t length,
+                                         uint32_t numberOfBits)
+{
+  uint8_t checkBits = length / BASE8_BIT_LENGTH;
+  uint32_t group = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    group = (group << BASE8_BIT_LENGTH) | numbers[i];
+  }
+  for (uint8_t i = 0; i < length - 1; i++) {
+    numberOfBits += baseNumberOfBits[numbers[i]];
+  }
+  // Remove the check bits, 1 for a single byte and 2 for two bytes
+  uint32_t check = group & ((1u << checkBits) - 1);
+  group >>= checkBits;
+  for (uint8_t i = 0; i < checkBits; i++) {
+    decodedBytes[i] =
+        (uint8_t)(group >> (BASEX_BYTE_BIT_LENGTH * (checkBits - 1 - i)));
+  }
+  if (check != numberOfBits % (2 * checkBits)) {
+    return BASEX_SRCERROR;
+  }
+  return BASEX_OK;
+}
+
+#ifdef BASEX_X86_BMI2
+__attribute__((target("bmi2,popcnt"))) static void
+base8_encodeBMI2(uint8_t *encodedString,
+                 const uint8_t *srcBytes,
+                 size_t groups,
+                 uint32_t *numberOfBits)
+{
+  uint32_t bits = *numberOfBits;
+  for (size_t g = 0; g < groups; g++) {
+    uint32_t group = ((uint32_t)srcBytes[0] << 16) |
+                     ((uint32_t)srcBytes[1] << 8) | srcBytes[2];
+    // The digits partition the group, their set bits are the ones of the group
+    bits += (uint32_t)__builtin_popcount(group);
+    // The first digit lands in the highest byte, swap it to the front
+    uint64_t chars = __builtin_bswap64(_pdep_u64(group, BASE8_DIGIT_MASK)) +
+                     BASE8_CHAR_OFFSET;
+    memcpy(encodedString, &chars, sizeof(chars));
+    srcBytes += BASE8_GROUP_BYTES;
+    encodedString += BASE8_GROUP_CHARS;
+  }
+  *numberOfBits = bits;
+}
+
+__attribute__((target("bmi2,popcnt"))) static size_t
+base8_decodeBMI2(uint8_t *decodedBytes,
+                 const char *srcString,
+                 size_t groups,
+                 uint32_t *numberOfBits)
+{
+  const uint64_t high = 0x8080808080808080ull;
+  uint32_t bits = *numberOfBits;
+  size_t g = 0;
+  for (; g < groups; g++) {
+    uint64_t chars;
+    memcpy(&chars, srcString, sizeof(chars));
+    // Per byte without carries: '1' and above set bit 7 after adding 0x4F,
+    // above '8' sets it after adding 0x47
+    uint64_t ascii = chars & ~high;
+    uint64_t invalid = (chars | ~(ascii + 0x4F4F4F4F4F4F4F4Full) |
+                        (ascii + 0x4747474747474747ull)) &
+                       high;
+    if (invalid) {
+      break;
+    }
+    uint32_t group = (uint32_t)_pext_u64(
+        __builtin_bswap64(chars - BASE8_CHAR_OFFSET), BASE8_DIGIT_MASK);
+    bits += (uint32_t)__builtin_popcount(group);
+    decodedBytes[0] = (uint8_t)(group >> 16);
+    decodedBytes[1] = (uint8_t)(group >> 8);
+    decodedBytes[2] = (uint8_t)group;
+    srcString += BASE8_GROUP_CHARS;
+    decodedBytes += BASE8_GROUP_BYTES;
+  }
+  *numberOfBits = bits;
+  return g;
+}
+#endif
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Adds up the set bit counts of the sad_epu8 sums.
+ *
+ * @param[in] sum Two 64-bit sums of set bits.
+ * @return uint32_t Total number of set bits, modulo 2^32.
+ */
+__attribute__((target("sse4.1"))) static inline uint32_t
+base8_sumSSE41(__m128i sum)
+{
+  // Only the low 32 bits of the sums are needed
+  sum = _mm_add_epi32(sum, _mm_unpackhi_epi64(sum, sum));
+  return (uint32_t)_mm_cvtsi128_si32(sum);
+}
+
+/**
+ * @brief Adds up the set bit counts of the sad_epu8 sums.
+ *
+ * @param[in] sum Four 64-bit sums of set bits.
+ * @return uint32_t Total number of set bits, modulo 2^32.
+ */
+__attribute__((target("avx2"))) static inline uint32_t
+base8_sumAVX2(__m256i sum)
+{
+  return base8_sumSSE41(_mm_add_epi64(_mm256_castsi256_si128(sum),
+                                      _mm256_extracti128_si256(sum, 1)));
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base8_validateSSE41(const char *srcString,
+                    size_t srcLength,
+                    uint32_t *numberOfBits)
+{
+  const __m128i start = _mm_set1_epi8(BASE8_STARTCHAR);
+  const __m128i seven = _mm_set1_epi8(0x07);
+  const __m128i bitsLut =
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0);
+  __m128i sum = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= srcLength; i += 16) {
+    // Characters below '1' wrap around and are caught as well
+    __m128i numbers = _mm_sub_epi8(
+        _mm_loadu_si128((const __m128i *)(srcString + i)), start);
+    __m128i valid = _mm_cmpeq_epi8(_mm_min_epu8(numbers, seven), numbers);
+    int invalid = 0xFFFF ^ _mm_movemask_epi8(valid);
+    if (invalid) {
+      i += (size_t)__builtin_ctz((unsigned)invalid);
+      break;
+    }
+    __m128i bits = _mm_shuffle_epi8(bitsLut, numbers);
+    sum = _mm_add_epi64(sum, _mm_sad_epu8(bits, _mm_setzero_si128()));
+  }
+  *numberOfBits += base8_sumSSE41(sum);
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+base8_validateAVX2(const char *srcString,
+                   size_t srcLength,
+                   uint32_t *numberOfBits)
+{
+  const __m256i start = _mm256_set1_epi8(BASE8_STARTCHAR);
+  const __m256i seven = _mm256_set1_epi8(0x07);
+  const __m256i bitsLut = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0));
+  __m256i sum = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    // Characters below '1' wrap around and are caught as well
+    __m256i numbers = _mm256_sub_epi8(
+        _mm256_loadu_si256((const __m256i *)(srcString + i)), start);
+    __m256i valid =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(numbers, seven), numbers);
+    unsigned invalid = ~(unsigned)_mm256_movemask_epi8(valid);
+    if (invalid) {
+      i += (size_t)__builtin_ctz(invalid);
+      break;
+    }
+    __m256i bits = _mm256_shuffle_epi8(bitsLut, numbers);
+    sum = _mm256_add_epi64(sum,
+                           _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+  }
+  *numberOfBits += base8_sumAVX2(sum);
+  return i;
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base8_encodeSSE41(uint8_t *encodedString,
+                  const uint8_t *srcBytes,
+                  size_t groups,
+                  uint32_t *numberOfBits)
+{
+  const __m128i lowWords = _mm_setr_epi8(BASE8_SIMD_WORDS(0));
+  const __m128i highWords = _mm_setr_epi8(BASE8_SIMD_WORDS(3));
+  const __m128i tailWords = _mm_setr_epi8(BASE8_SIMD_WORDS(2));
+  const __m128i lastWords = _mm_setr_epi8(BASE8_SIMD_WORDS(5));
+  // Digit i of a word sits at bit 13 - 3i, move it to bit 0 with mulhi
+  const __m128i shifts = _mm_setr_epi16(8, 64, 512, 16, 128, 1024, 32, 256);
+  const __m128i seven = _mm_set1_epi16(0x07);
+  const __m128i start = _mm_set1_epi8(BASE8_STARTCHAR);
+  const __m128i bitsLut =
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0);
+  __m128i sum = _mm_setzero_si128();
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4) {
+    // Groups 0 and 1 sit at bytes 0 and 3, groups 2 and 3 at bytes 2 and 5
+    // of the second load, no byte past the block is read
+    __m128i first = _mm_loadl_epi64((const __m128i *)srcBytes);
+    __m128i second = _mm_loadl_epi64((const __m128i *)(srcBytes + 4));
+    __m128i digits = _mm_packus_epi16(
+        _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(first, lowWords), shifts),
+            seven),
+        _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(first, highWords), shifts),
+            seven));
+    __m128i nextDigits = _mm_packus_epi16(
+        _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(second, tailWords), shifts),
+            seven),
+        _mm_and_si128(
+            _mm_mulhi_epu16(_mm_shuffle_epi8(second, lastWords), shifts),
+            seven));
+    __m128i bits = _mm_add_epi8(_mm_shuffle_epi8(bitsLut, digits),
+                                _mm_shuffle_epi8(bitsLut, nextDigits));
+    sum = _mm_add_epi64(sum, _mm_sad_epu8(bits, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *)encodedString, _mm_add_epi8(digits, start));
+    _mm_storeu_si128((__m128i *)(encodedString + 16),
+                     _mm_add_epi8(nextDigits, start));
+    srcBytes += 4 * BASE8_GROUP_BYTES;
+    encodedString += 4 * BASE8_GROUP_CHARS;
+  }
+  *numberOfBits += base8_sumSSE41(sum);
+  return g;
+}
+
+__attribute__((target("avx2"))) static size_t
+base8_encodeAVX2(uint8_t *encodedString,
+                 const uint8_t *srcBytes,
+                 size_t groups,
+                 uint32_t *numberOfBits)
+{
+  const __m256i firstWords =
+      _mm256_setr_epi8(BASE8_SIMD_WORDS(0), BASE8_SIMD_WORDS(2));
+  const __m256i secondWords =
+      _mm256_setr_epi8(BASE8_SIMD_WORDS(3), BASE8_SIMD_WORDS(5));
+  // Digit i of a word sits at bit 13 - 3i, move it to bit 0 with mulhi
+  const __m256i shifts = _mm256_setr_epi16(8, 64, 512, 16, 128, 1024, 32, 256,
+                                           8, 64, 512, 16, 128, 1024, 32, 256);
+  const __m256i seven = _mm256_set1_epi16(0x07);
+  const __m256i start = _mm256_set1_epi8(BASE8_STARTCHAR);
+  const __m256i bitsLut = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0));
+  __m256i sum = _mm256_setzero_si256();
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4) {
+    // Groups 0 and 1 sit at bytes 0 and 3 of the low lane, groups 2 and 3 at
+    // bytes 2 and 5 of the high lane, no byte past the block is read
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)srcBytes)),
+        _mm_loadl_epi64((const __m128i *)(srcBytes + 4)), 1);
+    __m256i first = _mm256_and_si256(
+        _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, firstWords), shifts),
+        seven);
+    __m256i second = _mm256_and_si256(
+        _mm256_mulhi_epu16(_mm256_shuffle_epi8(in, secondWords), shifts),
+        seven);
+    __m256i digits = _mm256_packus_epi16(first, second);
+    __m256i bits = _mm256_shuffle_epi8(bitsLut, digits);
+    sum = _mm256_add_epi64(sum,
+                           _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+    _mm256_storeu_si256((__m256i *)encodedString,
+                        _mm256_add_epi8(digits, start));
+    srcBytes += 4 * BASE8_GROUP_BYTES;
+    encodedString += 4 * BASE8_GROUP_CHARS;
+  }
+  *numberOfBits += base8_sumAVX2(sum);
+  return g;
+}
+
+__attribute__((target("sse4.1"))) static size_t
+base8_decodeSSE41(uint8_t *decodedBytes,
+                  const uint8_t *srcNumbers,
+                  size_t groups,
+                  uint8_t offset,
+                  uint32_t *numberOfBits)
+{
+  const __m128i start = _mm_set1_epi8((char)offset);
+  const __m128i seven = _mm_set1_epi8(0x07);
+  const __m128i bitsLut =
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i pairs = _mm_set1_epi16(0x0108);
+  const __m128i quads = _mm_set1_epi32(0x00010040);
+  const __m128i gather =
+      _mm_setr_epi8(2, 1, 0, 10, 9, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  __m128i sum = _mm_setzero_si128();
+  size_t g = 0;
+  for (; g + 2 <= groups; g += 2) {
+    // Values below the offset wrap around and are caught as well
+    __m128i numbers = _mm_sub_epi8(
+        _mm_loadu_si128((const __m128i *)srcNumbers), start);
+    __m128i valid = _mm_cmpeq_epi8(_mm_min_epu8(numbers, seven), numbers);
+    if (0xFFFF != _mm_movemask_epi8(valid)) {
+      break;
+    }
+    __m128i bits = _mm_shuffle_epi8(bitsLut, numbers);
+    sum = _mm_add_epi64(sum, _mm_sad_epu8(bits, _mm_setzero_si128()));
+    // 2 numbers to 6 bits, 4 numbers to 12 bits and 8 numbers to 24 bits
+    __m128i value =
+        _mm_madd_epi16(_mm_maddubs_epi16(numbers, pairs), quads);
+    value = _mm_or_si128(_mm_slli_epi64(value, 12), _mm_srli_epi64(value, 32));
+    value = _mm_shuffle_epi8(value, gather);
+    // Exactly 6 bytes are written, decoding in place stays safe
+    uint32_t head = (uint32_t)_mm_cvtsi128_si32(value);
+    uint16_t tail = (uint16_t)_mm_extract_epi16(value, 2);
+    memcpy(decodedBytes, &head, sizeof(head));
+    memcpy(decodedBytes + sizeof(head), &tail, sizeof(tail));
+    srcNumbers += 2 * BASE8_GROUP_CHARS;
+    decodedBytes += 2 * BASE8_GROUP_BYTES;
+  }
+  *numberOfBits += base8_sumSSE41(sum);
+  return g;
+}
+
+__attribute__((target("avx2"))) static size_t
+base8_decodeAVX2(uint8_t *decodedBytes,
+                 const uint8_t *srcNumbers,
+                 size_t groups,
+                 uint8_t offset,
+                 uint32_t *numberOfBits)
+{
+  const __m256i start = _mm256_set1_epi8((char)offset);
+  const __m256i seven = _mm256_set1_epi8(0x07);
+  const __m256i bitsLut = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0));
+  const __m256i pairs = _mm256_set1_epi16(0x0108);
+  const __m256i quads = _mm256_set1_epi32(0x00010040);
+  const __m256i gather = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(2, 1, 0, 10, 9, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+  __m256i sum = _mm256_setzero_si256();
+  size_t g = 0;
+  for (; g + 4 <= groups; g += 4) {
+    // Values below the offset wrap around and are caught as well
+    __m256i numbers = _mm256_sub_epi8(
+        _mm256_loadu_si256((const __m256i *)srcNumbers), start);
+    __m256i valid =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(numbers, seven), numbers);
+    if (-1 != _mm256_movemask_epi8(valid)) {
+      break;
+    }
+    __m256i bits = _mm256_shuffle_epi8(bitsLut, numbers);
+    sum = _mm256_add_epi64(sum,
+                           _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+    // 2 numbers to 6 bits, 4 numbers to 12 bits and 8 numbers to 24 bits
+    __m256i value =
+        _mm256_madd_epi16(_mm256_maddubs_epi16(numbers, pairs), quads);
+    value = _mm256_or_si256(_mm256_slli_epi64(value, 12),
+                            _mm256_srli_epi64(value, 32));
+    value = _mm256_shuffle_epi8(value, gather);
+    // 6 bytes per lane, the second lane overwrites the 2 spare bytes of the
+    // first one and exactly 12 bytes are written
+    __m128i high = _mm256_extracti128_si256(value, 1);
+    uint32_t head = (uint32_t)_mm_cvtsi128_si32(high);
+    uint16_t tail = (uint16_t)_mm_extract_epi16(high, 2);
+    _mm_storel_epi64((__m128i *)decodedBytes, _mm256_castsi256_si128(value));
+    memcpy(decodedBytes + 6, &head, sizeof(head));
+    memcpy(decodedBytes + 6 + sizeof(head), &tail, sizeof(tail));
+    srcNumbers += 4 * BASE8_GROUP_CHARS;
+    decodedBytes += 4 * BASE8_GROUP_BYTES;
+  }
+  *numberOfBits += base8_sumAVX2(sum);
+  return g;
+}
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file baseX_cpu.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Runtime CPU feature detection for the converter kernels.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "baseX_cpu.h"
+
+#define BASEX_CPU_UNKNOWN (0x80000000u) ///< Features not detected yet
+
+static volatile uint32_t detectedFeatures = BASEX_CPU_UNKNOWN;
+static volatile uint32_t featureMask = UINT32_MAX;
+
+/**
+ * @brief Detects the features of the running CPU.
+ *
+ * @return uint32_t Bit set of BASEX_CPU_* flags.
+ */
+static uint32_t baseX_cpuDetect(void)
+{
+  uint32_t features = 0;
+#ifdef BASEX_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.1")) {
+    features |= BASEX_CPU_SSE41;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    features |= BASEX_CPU_AVX2;
+  }
+  if (__builtin_cpu_supports("avx512vbmi") &&
+      __builtin_cpu_supports("avx512bw")) {
+    features |= BASEX_CPU_AVX512VBMI;
+  }
+#ifdef BASEX_X86_BMI2
+  // PDEP and PEXT are microcoded on AMD CPUs before Zen 3
+  if (__builtin_cpu_supports("bmi2") && !__builtin_cpu_is("amdfam15h") &&
+      !__builtin_cpu_is("amdfam17h")) {
+    features |= BASEX_CPU_BMI2;
+  }
+#endif
+#endif
+  return features;
+}
+
+uint32_t baseX_cpuFeatures(void)
+{
+  uint32_t features = detectedFeatures;
+  if (BASEX_CPU_UNKNOWN == features) {
+    // Detection is idempotent, a concurrent first call only repeats it
+    features = baseX_cpuDetect();
+    detectedFeatures = features;
+  }
+  return features & featureMask;
+}
+
+void baseX_cpuSetMask(uint32_t mask)
+{
+  featureMask = mask;
+}
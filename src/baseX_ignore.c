@@ -0,0 +1,159 @@
+/**
+ * @file baseX_ignore.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Sets of ignorable characters and the vectorized scan for them.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "baseX_ignore.h"
+#include "baseX_cpu.h"
+
+#ifdef BASEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define BASEX_IGNORE_ASCII (0x80) ///< First character which cannot be ignored
+
+const baseX_ignoreSet baseX_whitespace = {
+    .nibbles = {[0x0] = 0x04, [0x9] = 0x01, [0xA] = 0x01, [0xB] = 0x01,
+                [0xC] = 0x01, [0xD] = 0x01},
+    .characters = {[' '] = 1, ['\t'] = 1, ['\n'] = 1, ['\v'] = 1, ['\f'] = 1,
+                   ['\r'] = 1}};
+
+#ifdef BASEX_X86_SIMD
+/**
+ * @brief Scans the characters in blocks of 16 with SSE4.1.
+ *
+ * @param[in] srcString Characters to scan.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] set The ignorable characters.
+ * @return size_t Position of the first ignorable character, or the number of
+ * scanned characters (a multiple of 16) if there is none.
+ */
+static size_t baseX_ignoreSpanSSE41(const char *srcString,
+                                    size_t srcLength,
+                                    const baseX_ignoreSet *set);
+
+/**
+ * @brief Scans the characters in blocks of 32 with AVX2.
+ *
+ * @param[in] srcString Characters to scan.
+ * @param[in] srcLength Number of characters in srcString.
+ * @param[in] set The ignorable characters.
+ * @return size_t Position of the first ignorable character, or the number of
+ * scanned characters (a multiple of 32) if there is none.
+ */
+static size_t baseX_ignoreSpanAVX2(const char *srcString,
+                                   size_t srcLength,
+                                   const baseX_ignoreSet *set);
+#endif
+
+baseX_returnType baseX_ignoreInit(baseX_ignoreSet *set, const char *characters)
+{
+  if (!set || !characters) {
+    return BASEX_ARGUMENTS;
+  }
+  baseX_ignoreSet resolved = {0};
+  for (const char *c = characters; *c; c++) {
+    uint8_t value = (uint8_t)*c;
+    if (value >= BASEX_IGNORE_ASCII) {
+      return BASEX_ARGUMENTS;
+    }
+    resolved.nibbles[value & 0x0F] |= (uint8_t)(1u << (value >> 4));
+    resolved.characters[value] = 1;
+  }
+  *set = resolved;
+  return BASEX_OK;
+}
+
+size_t baseX_ignoreSpan(const char *srcString,
+                        size_t srcLength,
+                        const baseX_ignoreSet *set)
+{
+  size_t i = 0;
+#ifdef BASEX_X86_SIMD
+  uint32_t features = baseX_cpuFeatures();
+  if (features & BASEX_CPU_AVX2) {
+    i = baseX_ignoreSpanAVX2(srcString, srcLength, set);
+  } else if (features & BASEX_CPU_SSE41) {
+    i = baseX_ignoreSpanSSE41(srcString, srcLength, set);
+  }
+#endif
+  while (i < srcLength && !set->characters[(uint8_t)srcString[i]]) {
+    i++;
+  }
+  return i;
+}
+
+#ifdef BASEX_X86_SIMD
+__attribute__((target("sse4.1"))) static size_t
+baseX_ignoreSpanSSE41(const char *srcString,
+                      size_t srcLength,
+                      const baseX_ignoreSet *set)
+{
+  // The entry of the low nibble has bit h set if 0xhl is ignorable. Bytes of
+  // 0x80 and above select no bit and are never ignorable.
+  const __m128i lutLow = _mm_loadu_si128((const __m128i *)set->nibbles);
+  const __m128i lutHigh = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20,
+                                        0x40, (char)0x80, 0, 0, 0, 0, 0, 0, 0,
+                                        0);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= srcLength; i += 16) {
+    __m128i in = _mm_loadu_si128((const __m128i *)(srcString + i));
+    __m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+    __m128i bits =
+        _mm_and_si128(_mm_shuffle_epi8(lutLow, _mm_and_si128(in, nibble)),
+                      _mm_shuffle_epi8(lutHigh, high));
+    int ignorable =
+        0xFFFF ^ _mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()));
+    if (ignorable) {
+      return i + (size_t)__builtin_ctz((unsigned)ignorable);
+    }
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static size_t
+baseX_ignoreSpanAVX2(const char *srcString,
+                     size_t srcLength,
+                     const baseX_ignoreSet *set)
+{
+  const __m256i lutLow = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i *)set->nibbles));
+  const __m256i lutHigh = _mm256_broadcastsi128_si256(
+      _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, 0,
+                    0, 0, 0, 0, 0, 0, 0));
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 32 <= srcLength; i += 32) {
+    __m256i in = _mm256_loadu_si256((const __m256i *)(srcString + i));
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble);
+    __m256i bits = _mm256_and_si256(
+        _mm256_shuffle_epi8(lutLow, _mm256_and_si256(in, nibble)),
+        _mm256_shuffle_epi8(lutHigh, high));
+    unsigned ignorable = ~(unsigned)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(bits, _mm256_setzero_si256()));
+    if (ignorable) {
+      return i + (size_t)__builtin_ctz(ignorable);
+    }
+  }
+  return i;
+}
+#endif
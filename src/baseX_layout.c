@@ -0,0 +1,163 @@
+/**
+ * @file baseX_layout.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Line wrapping and grouping of encoded output.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "baseX_layout.h"
+
+#include <string.h>
+
+/**
+ * @brief Returns whether the layout can be written.
+ *
+ * @param[in] layout The layout.
+ * @return int 1 if valid, 0 otherwise.
+ */
+static int baseX_layoutValid(const baseX_layout *layout);
+
+/**
+ * @brief Writes the separator in front of the next unit.
+ *
+ * @param[in,out] writer Writer state.
+ */
+static void baseX_layoutSeparate(baseX_layoutWriter *writer);
+
+size_t baseX_layoutLength(size_t characters, const baseX_layout *layout)
+{
+  if (!baseX_layoutValid(layout)) {
+    return SIZE_MAX;
+  }
+  if (0 == characters) {
+    return 0;
+  }
+  size_t lines = 1;
+  size_t groups = 1;
+  if (layout->lineLength) {
+    lines = characters / layout->lineLength +
+            (characters % layout->lineLength ? 1 : 0);
+  }
+  if (layout->groupLength) {
+    groups = characters / layout->groupLength +
+             (characters % layout->groupLength ? 1 : 0);
+  }
+  // Line boundaries are group boundaries, every other group gets a separator
+  size_t lineSeparators = layout->lineLength ? lines - 1 : 0;
+  size_t groupSeparators = layout->groupLength ? groups - lines : 0;
+  size_t lineSeparatorLength =
+      layout->lineLength ? strlen(layout->lineSeparator) : 0;
+  size_t groupSeparatorLength =
+      layout->groupLength ? strlen(layout->groupSeparator) : 0;
+
+  size_t length = characters;
+  if (lineSeparatorLength &&
+      lineSeparators > (SIZE_MAX - length) / lineSeparatorLength) {
+    return SIZE_MAX; // Output length not representable
+  }
+  length += lineSeparators * lineSeparatorLength;
+  if (groupSeparatorLength &&
+      groupSeparators > (SIZE_MAX - length) / groupSeparatorLength) {
+    return SIZE_MAX;
+  }
+  return length + groupSeparators * groupSeparatorLength;
+}
+
+baseX_returnType baseX_layoutInit(baseX_layoutWriter *writer,
+                                  char *out,
+                                  const baseX_layout *layout)
+{
+  if (!writer || !out || !baseX_layoutValid(layout)) {
+    return BASEX_ARGUMENTS;
+  }
+  memset(writer, 0, sizeof(*writer));
+  writer->out = out;
+  if (layout->lineLength) {
+    writer->lineSeparator = layout->lineSeparator;
+    writer->lineSeparatorLength = strlen(layout->lineSeparator);
+  }
+  if (layout->groupLength) {
+    writer->unit = layout->groupLength;
+    writer->unitsPerLine = layout->lineLength / layout->groupLength;
+    writer->unitSeparator = layout->groupSeparator;
+    writer->unitSeparatorLength = strlen(layout->groupSeparator);
+  } else if (layout->lineLength) {
+    // Every unit is a whole line
+    writer->unit = layout->lineLength;
+    writer->unitsPerLine = 1;
+  }
+  return BASEX_OK;
+}
+
+void baseX_layoutWrite(baseX_layoutWriter *writer,
+                       const char *chars,
+                       size_t count)
+{
+  const size_t unit = writer->unit;
+  if (0 == unit) {
+    memcpy(writer->out, chars, count);
+    writer->out += count;
+    return;
+  }
+  // Complete the current unit
+  size_t n = unit - writer->column;
+  if (n > count) {
+    n = count;
+  }
+  memcpy(writer->out, chars, n);
+  writer->out += n;
+  writer->column += n;
+  chars += n;
+  count -= n;
+
+  // Whole units as fixed size blocks, then the start of the next one
+  for (; count >= unit; chars += unit, count -= unit) {
+    baseX_layoutSeparate(writer);
+    memcpy(writer->out, chars, unit);
+    writer->out += unit;
+    writer->column = unit;
+  }
+  if (count) {
+    baseX_layoutSeparate(writer);
+    memcpy(writer->out, chars, count);
+    writer->out += count;
+    writer->column = count;
+  }
+}
+
+static int baseX_layoutValid(const baseX_layout *layout)
+{
+  return layout && (!layout->lineLength || layout->lineSeparator) &&
+         (!layout->groupLength || layout->groupSeparator) &&
+         (!layout->lineLength || !layout->groupLength ||
+          0 == layout->lineLength % layout->groupLength);
+}
+
+static void baseX_layoutSeparate(baseX_layoutWriter *writer)
+{
+  if (++writer->units == writer->unitsPerLine) {
+    memcpy(writer->out, writer->lineSeparator, writer->lineSeparatorLength);
+    writer->out += writer->lineSeparatorLength;
+    writer->units = 0;
+  } else {
+    memcpy(writer->out, writer->unitSeparator, writer->unitSeparatorLength);
+    writer->out += writer->unitSeparatorLength;
+  }
+  writer->column = 0;
+}
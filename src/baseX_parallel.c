@@ -0,0 +1,376 @@
+/**
+ * @file baseX_parallel.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Multithreaded encoding and decoding of large buffers.
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "baseX_parallel.h"
+#include "base16_converter.h"
+#include "base32_converter.h"
+#include "base8_converter.h"
+#include "baseX_cpu.h"
+
+#ifndef BASEX_NO_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifndef BASEX_PARALLEL_MIN_PART
+#define BASEX_PARALLEL_MIN_PART (65536u) ///< Minimum input bytes per thread
+#endif
+
+/**
+ * @brief Group sizes of a base, the input is only split between groups.
+ *
+ */
+typedef struct {
+  size_t groupBytes; ///< Bytes of a complete group
+  size_t groupChars; ///< Characters of a complete group
+} baseX_parallelGroup;
+
+static const baseX_parallelGroup baseX_parallelGroups[] = {
+    [BASEX_BASE8] = {BASE8_GROUP_BYTES, BASE8_GROUP_CHARS},
+    [BASEX_BASE16] = {1, 2},
+    [BASEX_BASE32] = {BASE32_GROUP_BYTES, BASE32_GROUP_CHARS},
+};
+
+/**
+ * @brief Part of the input converted by one thread.
+ *
+ */
+typedef struct {
+  baseX_base base;       ///< Base of the conversion
+  uint8_t encode;        ///< Encode if set, decode otherwise
+  const void *src;       ///< Input of this part, complete groups only
+  size_t srcLength;      ///< Number of input bytes or characters
+  void *dst;             ///< Output of this part
+  size_t dstLength;      ///< Expected number of output bytes or characters
+  uint32_t numberOfBits; ///< Set bits of the base8 numbers of this part
+  baseX_returnType ret;  ///< Status code of this part
+} baseX_parallelPart;
+
+/**
+ * @brief Converts one part with the incremental converters.
+ *
+ * @param[in,out] arg The baseX_parallelPart to convert.
+ * @return void* Always NULL.
+ */
+static void *baseX_parallelWorker(void *arg);
+
+/**
+ * @brief Returns the number of threads to use.
+ *
+ * @param[in] threads Requested number of threads or BASEX_PARALLEL_AUTO.
+ * @param[in] srcLength Number of input bytes or characters.
+ * @return unsigned int Number of threads, at least 1.
+ */
+static unsigned int baseX_parallelThreads(unsigned int threads,
+                                          size_t srcLength);
+
+/**
+ * @brief Splits the complete groups into parts and converts them.
+ *
+ * @param[in] base Base of the conversion.
+ * @param[in] encode Encode if set, decode otherwise.
+ * @param[out] dst Output buffer.
+ * @param[in] src Input bytes or characters.
+ * @param[in] groups Number of complete groups to convert.
+ * @param[in] threads Requested number of threads or BASEX_PARALLEL_AUTO.
+ * @param[out] numberOfBits Set bits of all base8 numbers.
+ * @return baseX_returnType Status code of the first failed part.
+ */
+static baseX_returnType baseX_parallelRun(baseX_base base,
+                                          uint8_t encode,
+                                          uint8_t *dst,
+                                          const uint8_t *src,
+                                          size_t groups,
+                                          unsigned int threads,
+                                          uint32_t *numberOfBits);
+
+baseX_returnType baseX_parallelEncode(baseX_base base,
+                                      char *encodedString,
+                                      size_t encodedSize,
+                                      const uint8_t *srcBytes,
+                                      size_t srcLength,
+                                      unsigned int threads)
+{
+  if (!encodedString || !srcBytes || base > BASEX_BASE32) {
+    return BASEX_ARGUMENTS;
+  }
+  size_t outputLength = BASEX_BASE8 == base    ? base8_encodedLength(srcLength)
+                        : BASEX_BASE16 == base ? base16_encodedLength(srcLength)
+                                               : base32_encodedLength(srcLength);
+  if (outputLength >= encodedSize) { // +1 for null terminator
+    return BASEX_OVERFLOW;
+  }
+
+  const baseX_parallelGroup *group = &baseX_parallelGroups[base];
+  size_t groups = srcLength / group->groupBytes;
+  uint32_t numberOfBits = 0;
+  baseX_returnType ret = baseX_parallelRun(base, 1, (uint8_t *)encodedString,
+                                           srcBytes, groups, threads,
+                                           &numberOfBits);
+  if (BASEX_OK != ret) {
+    return ret;
+  }
+
+  // The incomplete group is encoded with the one-shot functions, which also
+  // write the padding and the NULL-terminator
+  size_t done = groups * group->groupBytes;
+  size_t written = groups * group->groupChars;
+  char *tail = encodedString + written;
+  size_t tailSize = encodedSize - written;
+  switch (base) {
+  case BASEX_BASE8: {
+    // The check number depends on all previous numbers
+    base8_encodeContext ctx;
+    size_t length = 0;
+    base8_encodeInit(&ctx);
+    ctx.numberOfBits = numberOfBits;
+    ret = base8_encodeUpdate(&ctx, (uint8_t *)tail, tailSize, &length,
+                             srcBytes + done, srcLength - done);
+    if (BASEX_OK == ret) {
+      ret = base8_encodeFinal(&ctx, (uint8_t *)tail, tailSize, &length);
+    }
+    if (BASEX_OK == ret) {
+      tail[length] = '\0';
+    }
+    break;
+  }
+  case BASEX_BASE16:
+    ret = base16_encodeBytes(tail, tailSize, srcBytes + done, srcLength - done);
+    break;
+  default:
+    ret = base32_encodeBytes(tail, tailSize, srcBytes + done, srcLength - done);
+    break;
+  }
+  return ret;
+}
+
+baseX_returnType baseX_parallelDecode(baseX_base base,
+                                      uint8_t *decodedBytes,
+                                      size_t *decodedLength,
+                                      size_t decodedBytesSize,
+                                      const char *srcString,
+                                      size_t srcLength,
+                                      unsigned int threads)
+{
+  if (!decodedBytes || !decodedLength || !srcString || base > BASEX_BASE32) {
+    return BASEX_ARGUMENTS;
+  }
+  if (0 == srcLength) {
+    return BASEX_SRCERROR;
+  }
+
+  // The last group, which may be incomplete or padded, is always left to
+  // the one-shot functions
+  const baseX_parallelGroup *group = &baseX_parallelGroups[base];
+  size_t groups = (srcLength - 1) / group->groupChars;
+  size_t done = groups * group->groupChars;
+  size_t written = groups * group->groupBytes;
+  if (written > decodedBytesSize) {
+    return BASEX_OVERFLOW;
+  }
+  uint32_t numberOfBits = 0;
+  baseX_returnType ret =
+      baseX_parallelRun(base, 0, decodedBytes, (const uint8_t *)srcString,
+                        groups, threads, &numberOfBits);
+  if (BASEX_OK != ret) {
+    return ret;
+  }
+
+  uint8_t *tail = decodedBytes + written;
+  size_t tailSize = decodedBytesSize - written;
+  size_t length = 0;
+  switch (base) {
+  case BASEX_BASE8: {
+    // The check number depends on all previous numbers
+    base8_decodeContext ctx;
+    size_t finalLength = 0;
+    base8_decodeInit(&ctx);
+    ctx.numberOfBits = numberOfBits;
+    ret = base8_decodeUpdate(&ctx, tail, tailSize, &length, srcString + done,
+                             srcLength - done);
+    if (BASEX_OK == ret) {
+      ret = base8_decodeFinal(&ctx, tail + length, tailSize - length,
+                              &finalLength);
+      length += finalLength;
+    }
+    break;
+  }
+  case BASEX_BASE16:
+    ret = base16_decodeN(tail, &length, tailSize, srcString + done,
+                         srcLength - done);
+    break;
+  default:
+    ret = base32_decodeN(tail, &length, tailSize, srcString + done,
+                         srcLength - done);
+    break;
+  }
+  if (BASEX_OK == ret) {
+    *decodedLength = written + length;
+  }
+  return ret;
+}
+
+static void *baseX_parallelWorker(void *arg)
+{
+  baseX_parallelPart *part = (baseX_parallelPart *)arg;
+  size_t length = 0;
+  baseX_returnType ret = BASEX_ERROR;
+
+  switch (part->base) {
+  case BASEX_BASE8:
+    if (part->encode) {
+      base8_encodeContext ctx;
+      base8_encodeInit(&ctx);
+      ret = base8_encodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                               part->src, part->srcLength);
+      part->numberOfBits = ctx.numberOfBits;
+    } else {
+      base8_decodeContext ctx;
+      base8_decodeInit(&ctx);
+      ret = base8_decodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                               part->src, part->srcLength);
+      part->numberOfBits = ctx.numberOfBits;
+    }
+    break;
+  case BASEX_BASE16:
+    if (part->encode) {
+      base16_encodeContext ctx;
+      base16_encodeInit(&ctx);
+      ret = base16_encodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                                part->src, part->srcLength);
+    } else {
+      base16_decodeContext ctx;
+      base16_decodeInit(&ctx);
+      ret = base16_decodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                                part->src, part->srcLength);
+    }
+    break;
+  case BASEX_BASE32:
+    if (part->encode) {
+      base32_encodeContext ctx;
+      base32_encodeInit(&ctx);
+      ret = base32_encodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                                part->src, part->srcLength);
+    } else {
+      base32_decodeContext ctx;
+      base32_decodeInit(&ctx);
+      ret = base32_decodeUpdate(&ctx, part->dst, part->dstLength, &length,
+                                part->src, part->srcLength);
+    }
+    break;
+  }
+  // Padding is only allowed in the last group, which is never part of a
+  // thread, so every character has to produce output
+  if (BASEX_OK == ret && length != part->dstLength) {
+    ret = BASEX_SRCERROR;
+  }
+  part->ret = ret;
+  return NULL;
+}
+
+static unsigned int baseX_parallelThreads(unsigned int threads,
+                                          size_t srcLength)
+{
+#ifdef BASEX_NO_THREADS
+  (void)threads;
+  (void)srcLength;
+  return 1;
+#else
+  if (BASEX_PARALLEL_AUTO == threads) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = processors > 0 ? (unsigned int)processors : 1;
+  }
+  if (threads > BASEX_PARALLEL_MAX_THREADS) {
+    threads = BASEX_PARALLEL_MAX_THREADS;
+  }
+  size_t maxThreads = srcLength / BASEX_PARALLEL_MIN_PART;
+  if (threads > maxThreads) {
+    threads = (unsigned int)maxThreads;
+  }
+  return threads ? threads : 1;
+#endif
+}
+
+static baseX_returnType baseX_parallelRun(baseX_base base,
+                                          uint8_t encode,
+                                          uint8_t *dst,
+                                          const uint8_t *src,
+                                          size_t groups,
+                                          unsigned int threads,
+                                          uint32_t *numberOfBits)
+{
+  const baseX_parallelGroup *group = &baseX_parallelGroups[base];
+  size_t srcGroup = encode ? group->groupBytes : group->groupChars;
+  size_t dstGroup = encode ? group->groupChars : group->groupBytes;
+  baseX_parallelPart parts[BASEX_PARALLEL_MAX_THREADS];
+  unsigned int count = baseX_parallelThreads(threads, groups * srcGroup);
+
+  // Spread the groups evenly, the first parts get one more if not divisible
+  size_t first = 0;
+  for (unsigned int i = 0; i < count; i++) {
+    size_t partGroups = groups / count + (i < groups % count ? 1 : 0);
+    parts[i] = (baseX_parallelPart){.base = base,
+                                    .encode = encode,
+                                    .src = src + first * srcGroup,
+                                    .srcLength = partGroups * srcGroup,
+                                    .dst = dst + first * dstGroup,
+                                    .dstLength = partGroups * dstGroup,
+                                    .numberOfBits = 0,
+                                    .ret = BASEX_ERROR};
+    first += partGroups;
+  }
+
+#ifdef BASEX_NO_THREADS
+  for (unsigned int i = 0; i < count; i++) {
+    baseX_parallelWorker(&parts[i]);
+  }
+#else
+  // Detect the CPU features once before the threads use them
+  (void)baseX_cpuFeatures();
+  pthread_t handles[BASEX_PARALLEL_MAX_THREADS];
+  uint8_t started[BASEX_PARALLEL_MAX_THREADS] = {0};
+  for (unsigned int i = 1; i < count; i++) {
+    started[i] = (uint8_t)(0 == pthread_create(&handles[i], NULL,
+                                               baseX_parallelWorker,
+                                               &parts[i]));
+  }
+  baseX_parallelWorker(&parts[0]);
+  for (unsigned int i = 1; i < count; i++) {
+    if (started[i]) {
+      pthread_join(handles[i], NULL);
+    } else {
+      // Not enough resources for another thread, convert it here
+      baseX_parallelWorker(&parts[i]);
+    }
+  }
+#endif
+
+  *numberOfBits = 0;
+  for (unsigned int i = 0; i < count; i++) {
+    if (BASEX_OK != parts[i].ret) {
+      return parts[i].ret;
+    }
+    *numberOfBits += parts[i].numberOfBits;
+  }
+  return BASEX_OK;
+}
@@ -0,0 +1,529 @@
+/**
+ * @file bench_baseXLib.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Throughput benchmark for the baseX library
+ *
+ * Measures encode and decode of every base for input sizes from 16 B to
+ * 64 MiB, once with warm caches (the same buffers converted repeatedly) and
+ * once with cold caches (the caches are evicted before every call). The
+ * results are printed as CSV or JSON to compare releases.
+ *
+ * The size and throughput always refer to the raw (decoded) bytes, so
+ * encode and decode results of different bases are comparable.
+ *
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "base16_converter.h"
+#include "base32_converter.h"
+#include "base64_converter.h"
+#include "base8_converter.h"
+#include "baseX_cpu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MIN_SIZE (16)                  ///< Smallest input size
+#define BENCH_MAX_SIZE (64u * 1024u * 1024u) ///< Largest input size
+#define BENCH_WARM_TIME_NS (50000000ull)     ///< Minimum time of a warm run
+#define BENCH_WARM_RUNS (3)                  ///< Warm runs, the best counts
+#define BENCH_COLD_BYTES (16u * 1024u * 1024u) ///< Cold bytes per case
+#define BENCH_COLD_MIN_SAMPLES (3)   ///< Minimum number of cold samples
+#define BENCH_COLD_MAX_SAMPLES (15) ///< Maximum number of cold samples
+#define BENCH_DEFAULT_LLC (64u * 1024u * 1024u) ///< Fallback cache size
+
+/**
+ * @brief Output format of the results
+ *
+ */
+typedef enum { BENCH_CSV, BENCH_JSON } bench_format;
+
+/**
+ * @brief Buffers shared by all benchmark cases
+ *
+ */
+typedef struct {
+  uint8_t *raw;        ///< Random input bytes
+  char *encoded;       ///< Encoded raw bytes, input of the decoders
+  uint8_t *output;     ///< Output of the measured function
+  size_t outputSize;   ///< Size of output
+  uint8_t *evict;      ///< Buffer written to evict the caches
+  size_t evictSize;    ///< Size of evict
+  size_t encodedCount; ///< Number of characters in encoded
+} bench_buffers;
+
+/**
+ * @brief Converts the first size raw bytes or their encoding
+ *
+ * @param[in] b The shared buffers.
+ * @param[in] size Number of raw bytes.
+ * @return baseX_returnType Status code of the converter.
+ */
+typedef baseX_returnType (*bench_function)(bench_buffers *b, size_t size);
+
+/**
+ * @brief A measured converter function
+ *
+ */
+typedef struct {
+  const char *codec;       ///< Name of the base
+  const char *operation;   ///< encode, decode or validate
+  bench_function function; ///< The measured function
+  bench_function prepare;  ///< Prepares the input of a decoder, or NULL
+} bench_case;
+
+static baseX_returnType bench_base8Encode(bench_buffers *b, size_t size)
+{
+  return base8_encodeBytes(b->output, b->outputSize, b->raw, size);
+}
+
+static baseX_returnType bench_base8Prepare(bench_buffers *b, size_t size)
+{
+  baseX_returnType ret =
+      base8_encodeBytes((uint8_t *)b->encoded, b->outputSize, b->raw, size);
+  if (BASEX_OK == ret) {
+    b->encodedCount = strlen(b->encoded);
+  }
+  return ret;
+}
+
+static baseX_returnType bench_base8Decode(bench_buffers *b, size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base8_decodeN(b->output, &decodedLength, b->outputSize, b->encoded,
+                       b->encodedCount);
+}
+
+static baseX_returnType bench_base8Validate(bench_buffers *b, size_t size)
+{
+  size_t errorOffset = 0;
+  (void)size;
+  return base8_validate(b->encoded, b->encodedCount, &errorOffset);
+}
+
+static baseX_returnType bench_base16Encode(bench_buffers *b, size_t size)
+{
+  return base16_encodeBytes((char *)b->output, b->outputSize, b->raw, size);
+}
+
+static baseX_returnType bench_base16Prepare(bench_buffers *b, size_t size)
+{
+  baseX_returnType ret =
+      base16_encodeBytes(b->encoded, b->outputSize, b->raw, size);
+  if (BASEX_OK == ret) {
+    b->encodedCount = strlen(b->encoded);
+  }
+  return ret;
+}
+
+static baseX_returnType bench_base16Decode(bench_buffers *b, size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base16_decodeN(b->output, &decodedLength, b->outputSize, b->encoded,
+                        b->encodedCount);
+}
+
+static baseX_returnType bench_base16DecodeConstantTime(bench_buffers *b,
+                                                       size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base16_decodeConstantTime(b->output, &decodedLength, b->outputSize,
+                                   b->encoded, b->encodedCount);
+}
+
+static baseX_returnType bench_base16Validate(bench_buffers *b, size_t size)
+{
+  size_t errorOffset = 0;
+  (void)size;
+  return base16_validate(b->encoded, b->encodedCount, &errorOffset);
+}
+
+static baseX_returnType bench_base32Encode(bench_buffers *b, size_t size)
+{
+  return base32_encodeBytes((char *)b->output, b->outputSize, b->raw, size);
+}
+
+static baseX_returnType bench_base32Prepare(bench_buffers *b, size_t size)
+{
+  baseX_returnType ret =
+      base32_encodeBytes(b->encoded, b->outputSize, b->raw, size);
+  if (BASEX_OK == ret) {
+    b->encodedCount = strlen(b->encoded);
+  }
+  return ret;
+}
+
+static baseX_returnType bench_base32Decode(bench_buffers *b, size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base32_decodeN(b->output, &decodedLength, b->outputSize, b->encoded,
+                        b->encodedCount);
+}
+
+static baseX_returnType bench_base32DecodeConstantTime(bench_buffers *b,
+                                                       size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base32_decodeConstantTime(b->output, &decodedLength, b->outputSize,
+                                   b->encoded, b->encodedCount);
+}
+
+static baseX_returnType bench_base32Validate(bench_buffers *b, size_t size)
+{
+  size_t errorOffset = 0;
+  (void)size;
+  return base32_validate(b->encoded, b->encodedCount, &errorOffset);
+}
+
+static baseX_returnType bench_base64Encode(bench_buffers *b, size_t size)
+{
+  return base64_encodeBytes((char *)b->output, b->outputSize, b->raw, size,
+                            BASE64_STANDARD);
+}
+
+static baseX_returnType bench_base64Prepare(bench_buffers *b, size_t size)
+{
+  baseX_returnType ret = base64_encodeBytes(b->encoded, b->outputSize, b->raw,
+                                            size, BASE64_STANDARD);
+  if (BASEX_OK == ret) {
+    b->encodedCount = strlen(b->encoded);
+  }
+  return ret;
+}
+
+static baseX_returnType bench_base64Decode(bench_buffers *b, size_t size)
+{
+  size_t decodedLength = 0;
+  (void)size;
+  return base64_decodeN(b->output, &decodedLength, b->outputSize, b->encoded,
+                        b->encodedCount, BASE64_STANDARD);
+}
+
+static const bench_case bench_cases[] = {
+    {"base8", "encode", bench_base8Encode, NULL},
+    {"base8", "decode", bench_base8Decode, bench_base8Prepare},
+    {"base8", "validate", bench_base8Validate, bench_base8Prepare},
+    {"base16", "encode", bench_base16Encode, NULL},
+    {"base16", "decode", bench_base16Decode, bench_base16Prepare},
+    {"base16", "decode_ct", bench_base16DecodeConstantTime,
+     bench_base16Prepare},
+    {"base16", "validate", bench_base16Validate, bench_base16Prepare},
+    {"base32", "encode", bench_base32Encode, NULL},
+    {"base32", "decode", bench_base32Decode, bench_base32Prepare},
+    {"base32", "decode_ct", bench_base32DecodeConstantTime,
+     bench_base32Prepare},
+    {"base32", "validate", bench_base32Validate, bench_base32Prepare},
+    {"base64", "encode", bench_base64Encode, NULL},
+    {"base64", "decode", bench_base64Decode, bench_base64Prepare},
+};
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds
+ *
+ * @return uint64_t Time in nanoseconds.
+ */
+static uint64_t bench_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Evicts the input and output buffers from the caches by writing a
+ * buffer twice the size of the last level cache.
+ *
+ * @param[in] b The shared buffers.
+ */
+static void bench_evict(bench_buffers *b)
+{
+  static uint8_t round = 0;
+  round++;
+  for (size_t i = 0; i < b->evictSize; i += 64) {
+    b->evict[i] = round;
+  }
+}
+
+/**
+ * @brief Compares two durations for qsort
+ *
+ */
+static int bench_compare(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Measures the function with warm caches.
+ *
+ * Repeats the function until BENCH_WARM_TIME_NS passed and returns the best
+ * average of BENCH_WARM_RUNS runs.
+ *
+ * @param[in] c The measured case.
+ * @param[in] b The shared buffers.
+ * @param[in] size Number of raw bytes.
+ * @param[out] iterations Total number of calls.
+ * @return double Nanoseconds per call, negative on a converter error.
+ */
+static double bench_warm(const bench_case *c,
+                         bench_buffers *b,
+                         size_t size,
+                         uint64_t *iterations)
+{
+  double best = -1.0;
+  *iterations = 0;
+  if (BASEX_OK != c->function(b, size)) { // Warm up the caches
+    return -1.0;
+  }
+  for (int run = 0; run < BENCH_WARM_RUNS; run++) {
+    uint64_t count = 0;
+    uint64_t batch = 1;
+    uint64_t start = bench_now();
+    uint64_t elapsed = 0;
+    while (elapsed < BENCH_WARM_TIME_NS) {
+      for (uint64_t i = 0; i < batch; i++) {
+        c->function(b, size);
+      }
+      count += batch;
+      batch *= 2;
+      elapsed = bench_now() - start;
+    }
+    double average = (double)elapsed / (double)count;
+    if (best < 0 || average < best) {
+      best = average;
+    }
+    *iterations += count;
+  }
+  return best;
+}
+
+/**
+ * @brief Measures the function with cold caches.
+ *
+ * Evicts the caches before every call and returns the median of the
+ * samples.
+ *
+ * @param[in] c The measured case.
+ * @param[in] b The shared buffers.
+ * @param[in] size Number of raw bytes.
+ * @param[out] iterations Number of samples.
+ * @return double Nanoseconds per call, negative on a converter error.
+ */
+static double bench_cold(const bench_case *c,
+                         bench_buffers *b,
+                         size_t size,
+                         uint64_t *iterations)
+{
+  uint64_t durations[BENCH_COLD_MAX_SAMPLES];
+  size_t samples = BENCH_COLD_BYTES / size;
+  if (samples < BENCH_COLD_MIN_SAMPLES) {
+    samples = BENCH_COLD_MIN_SAMPLES;
+  }
+  if (samples > BENCH_COLD_MAX_SAMPLES) {
+    samples = BENCH_COLD_MAX_SAMPLES;
+  }
+  for (size_t i = 0; i < samples; i++) {
+    bench_evict(b);
+    uint64_t start = bench_now();
+    if (BASEX_OK != c->function(b, size)) {
+      return -1.0;
+    }
+    durations[i] = bench_now() - start;
+  }
+  qsort(durations, samples, sizeof(durations[0]), bench_compare);
+  *iterations = samples;
+  return (double)durations[samples / 2];
+}
+
+/**
+ * @brief Prints one result line
+ *
+ */
+static void bench_print(bench_format format,
+                        int first,
+                        const bench_case *c,
+                        size_t size,
+                        const char *cache,
+                        uint64_t iterations,
+                        double nsPerCall)
+{
+  double nsPerByte = nsPerCall / (double)size;
+  double mbPerSecond = (double)size * 1000.0 / nsPerCall;
+  if (BENCH_CSV == format) {
+    printf("%s,%s,%zu,%s,%llu,%.4f,%.2f\n", c->codec, c->operation, size,
+           cache, (unsigned long long)iterations, nsPerByte, mbPerSecond);
+  } else {
+    printf("%s  {\"codec\": \"%s\", \"operation\": \"%s\", \"bytes\": %zu, "
+           "\"cache\": \"%s\", \"iterations\": %llu, \"ns_per_byte\": %.4f, "
+           "\"mb_per_s\": %.2f}",
+           first ? "" : ",\n", c->codec, c->operation, size, cache,
+           (unsigned long long)iterations, nsPerByte, mbPerSecond);
+  }
+  fflush(stdout);
+}
+
+/**
+ * @brief Returns the size of the last level cache in bytes
+ *
+ */
+static size_t bench_cacheSize(void)
+{
+  long size = -1;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+  size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (size <= 0) {
+    size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  }
+#endif
+  return size > 0 ? (size_t)size : BENCH_DEFAULT_LLC;
+}
+
+static void bench_usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [options]\n"
+          "  --format csv|json  Output format (default csv)\n"
+          "  --min-size BYTES   Smallest input size (default %u)\n"
+          "  --max-size BYTES   Largest input size (default %u)\n"
+          "  --codec NAME       Only measure base8, base16, base32 or base64\n"
+          "  --cache warm|cold  Only measure with warm or cold caches\n"
+          "  --cpu-mask MASK    Restrict the SIMD kernels, 0 for scalar\n",
+          name, BENCH_MIN_SIZE, BENCH_MAX_SIZE);
+}
+
+int main(int argc, char **argv)
+{
+  bench_format format = BENCH_CSV;
+  size_t minSize = BENCH_MIN_SIZE;
+  size_t maxSize = BENCH_MAX_SIZE;
+  const char *codec = NULL;
+  const char *cache = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+    if (0 == strcmp(argv[i], "--format")) {
+      format = 0 == strcmp(argv[++i], "json") ? BENCH_JSON : BENCH_CSV;
+    } else if (0 == strcmp(argv[i], "--min-size")) {
+      minSize = (size_t)strtoull(argv[++i], NULL, 0);
+    } else if (0 == strcmp(argv[i], "--max-size")) {
+      maxSize = (size_t)strtoull(argv[++i], NULL, 0);
+    } else if (0 == strcmp(argv[i], "--codec")) {
+      codec = argv[++i];
+    } else if (0 == strcmp(argv[i], "--cache")) {
+      cache = argv[++i];
+    } else if (0 == strcmp(argv[i], "--cpu-mask")) {
+      baseX_cpuSetMask((uint32_t)strtoul(argv[++i], NULL, 0));
+    } else {
+      bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (minSize < 1 || maxSize < minSize) {
+    bench_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Base8 needs the most space with 8 characters per 3 bytes
+  bench_buffers b = {0};
+  b.outputSize = maxSize / 3 * 8 + 16;
+  b.evictSize = 2 * bench_cacheSize();
+  b.raw = malloc(maxSize);
+  b.encoded = malloc(b.outputSize);
+  b.output = malloc(b.outputSize);
+  b.evict = malloc(b.evictSize);
+  if (!b.raw || !b.encoded || !b.output || !b.evict) {
+    fprintf(stderr, "Out of memory\n");
+    return EXIT_FAILURE;
+  }
+  srand(0x5EED);
+  for (size_t i = 0; i < maxSize; i++) {
+    b.raw[i] = (uint8_t)rand();
+  }
+  memset(b.output, 0, b.outputSize);
+  memset(b.evict, 0, b.evictSize);
+
+  if (BENCH_CSV == format) {
+    printf("codec,operation,bytes,cache,iterations,ns_per_byte,mb_per_s\n");
+  } else {
+    printf("[\n");
+  }
+
+  int first = 1;
+  int failed = 0;
+  for (size_t i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++) {
+    const bench_case *c = &bench_cases[i];
+    if (codec && strcmp(codec, c->codec)) {
+      continue;
+    }
+    for (size_t size = minSize; size <= maxSize; size *= 4) {
+      if (c->prepare && BASEX_OK != c->prepare(&b, size)) {
+        failed = 1;
+        continue;
+      }
+      uint64_t iterations = 0;
+      double ns = 0;
+      if (!cache || 0 == strcmp(cache, "warm")) {
+        ns = bench_warm(c, &b, size, &iterations);
+        if (ns < 0) {
+          failed = 1;
+          continue;
+        }
+        bench_print(format, first, c, size, "warm", iterations, ns);
+        first = 0;
+      }
+      if (!cache || 0 == strcmp(cache, "cold")) {
+        ns = bench_cold(c, &b, size, &iterations);
+        if (ns < 0) {
+          failed = 1;
+          continue;
+        }
+        bench_print(format, first, c, size, "cold", iterations, ns);
+        first = 0;
+      }
+    }
+  }
+  if (BENCH_JSON == format) {
+    printf("\n]\n");
+  }
+
+  free(b.raw);
+  free(b.encoded);
+  free(b.output);
+  free(b.evict);
+  if (failed) {
+    fprintf(stderr, "A converter returned an error\n");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file test_baseX.cpp
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief test application for the C++ interface of the baseX library
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#include "baseX.hpp"
+#include "unity.h"
+#include <string_view>
+
+void setUp(void)
+{
+} // Empty needed definition
+void tearDown(void)
+{
+} // Empty needed definition
+
+#define CPP_TEST_SIZE (40)
+
+using baseX::Base16;
+using baseX::Base32;
+using baseX::Base64;
+using baseX::Base64Url;
+using baseX::Base8;
+
+// Compile-time conversions
+constexpr std::array<std::byte, 5> foobaBytes = {
+    std::byte{'f'}, std::byte{'o'}, std::byte{'o'}, std::byte{'b'},
+    std::byte{'a'}};
+
+static_assert(std::string_view(baseX::encodeArray<Base32>(foobaBytes).data()) ==
+              "MZXW6YTB");
+static_assert(std::string_view(baseX::encodeArray<Base16>(foobaBytes).data()) ==
+              "666F6F6261");
+static_assert(std::string_view(baseX::encodeArray<Base64>(foobaBytes).data()) ==
+              "Zm9vYmE=");
+static_assert(
+    std::string_view(
+        baseX::encodeArray<Base8>(std::array<std::byte, 2>{
+                                      std::byte{0xA5}, std::byte{0xB3}})
+            .data()) == "624425");
+static_assert(baseX::decodeLiteral<Base32>("MZXW6===").length == 3);
+static_assert(baseX::decodeLiteral<Base16>("DEADbeef").data[3] ==
+              std::byte{0xEF});
+static_assert(baseX::decodeLiteral<Base64Url>("-_8=").data[1] ==
+              std::byte{0xFF});
+static_assert(baseX::decodeLiteral<Base8>("624425").data[0] ==
+              std::byte{0xA5});
+
+/// Test input of the given length
+constexpr std::array<std::byte, CPP_TEST_SIZE> testBytes()
+{
+  std::array<std::byte, CPP_TEST_SIZE> bytes{};
+  for (std::size_t i = 0; i < bytes.size(); i++) {
+    bytes[i] = static_cast<std::byte>(i * 37 + 11);
+  }
+  return bytes;
+}
+
+constexpr std::array<std::byte, CPP_TEST_SIZE> cppBytes = testBytes();
+
+template <class Base>
+using encodedTable =
+    std::array<std::array<char, baseX::encodedLength<Base>(CPP_TEST_SIZE)>,
+               CPP_TEST_SIZE + 1>;
+
+/// Encodes every prefix of cppBytes at compile time
+template <class Base>
+constexpr encodedTable<Base> compileTimeEncoded()
+{
+  encodedTable<Base> table{};
+  for (std::size_t n = 0; n <= CPP_TEST_SIZE; n++) {
+    baseX::encode<Base>(std::span<const std::byte>(cppBytes.data(), n),
+                        std::span<char>(table[n]));
+  }
+  return table;
+}
+
+/// Decodes every encoded prefix at compile time and compares it
+template <class Base>
+constexpr bool compileTimeRoundTrip()
+{
+  constexpr encodedTable<Base> table = compileTimeEncoded<Base>();
+  for (std::size_t n = 1; n <= CPP_TEST_SIZE; n++) {
+    std::array<std::byte, CPP_TEST_SIZE> decoded{};
+    baseX::result r = baseX::decode<Base>(
+        std::string_view(table[n].data(), baseX::encodedLength<Base>(n)),
+        decoded);
+    if (!r || n != r.length) {
+      return false;
+    }
+    for (std::size_t i = 0; i < n; i++) {
+      if (decoded[i] != cppBytes[i]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static_assert(compileTimeRoundTrip<Base8>());
+static_assert(compileTimeRoundTrip<Base16>());
+static_assert(compileTimeRoundTrip<Base32>());
+static_assert(compileTimeRoundTrip<Base64>());
+static_assert(compileTimeRoundTrip<Base64Url>());
+
+/// Runtime (C library) output must match the compile-time output
+template <class Base>
+static void compareEncoded(void)
+{
+  static constexpr encodedTable<Base> table = compileTimeEncoded<Base>();
+  TEST_ASSERT_TRUE(baseX::encode<Base>(std::span<const std::byte>()).empty());
+  for (std::size_t n = 1; n <= CPP_TEST_SIZE; n++) {
+    std::span<const std::byte> src(cppBytes.data(), n);
+    std::size_t length = baseX::encodedLength<Base>(n);
+    std::string encoded = baseX::encode<Base>(src);
+    TEST_ASSERT_EQUAL_size_t(length, encoded.size());
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(table[n].data(), encoded.data(), length);
+
+    // Exact buffer without room for a NULL-terminator
+    std::array<char, baseX::encodedLength<Base>(CPP_TEST_SIZE)> buffer{};
+    baseX::result r =
+        baseX::encode<Base>(src, std::span<char>(buffer.data(), length));
+    TEST_ASSERT_EQUAL(BASEX_OK, r.status);
+    TEST_ASSERT_EQUAL_size_t(length, r.length);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(table[n].data(), buffer.data(), length);
+
+    std::array<std::byte, CPP_TEST_SIZE> decoded{};
+    r = baseX::decode<Base>(std::string_view(encoded),
+                            std::span<std::byte>(decoded.data(), n));
+    TEST_ASSERT_EQUAL(BASEX_OK, r.status);
+    TEST_ASSERT_EQUAL_size_t(n, r.length);
+    TEST_ASSERT_EQUAL_MEMORY(cppBytes.data(), decoded.data(), n);
+
+    r = baseX::encode<Base>(src, std::span<char>(buffer.data(), length - 1));
+    TEST_ASSERT_EQUAL(BASEX_OVERFLOW, r.status);
+    r = baseX::decode<Base>(std::string_view(encoded),
+                            std::span<std::byte>(decoded.data(), n - 1));
+    TEST_ASSERT_EQUAL(BASEX_OVERFLOW, r.status);
+  }
+}
+
+void test_cpp_encode(void)
+{
+  compareEncoded<Base8>();
+  compareEncoded<Base16>();
+  compareEncoded<Base32>();
+  compareEncoded<Base64>();
+  compareEncoded<Base64Url>();
+}
+
+/// Status of a decode, evaluated at compile time
+template <class Base>
+constexpr baseX_returnType compileTimeStatus(std::string_view src)
+{
+  std::array<std::byte, CPP_TEST_SIZE> decoded{};
+  return baseX::decode<Base>(src, decoded).status;
+}
+
+/// Runtime (C library) status must match the compile-time status
+#define ASSERT_SAME_STATUS(base, string, expected)                             \
+  do {                                                                         \
+    constexpr baseX_returnType status = compileTimeStatus<base>(string);      \
+    std::array<std::byte, CPP_TEST_SIZE> decoded{};                            \
+    TEST_ASSERT_EQUAL(expected, status);                                       \
+    TEST_ASSERT_EQUAL(status, baseX::decode<base>(string, decoded).status);    \
+  } while (0)
+
+void test_fail_cpp_decode(void)
+{
+  ASSERT_SAME_STATUS(Base8, "", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base8, "1111", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base8, "119", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base8, "112", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base16, "ABC", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base16, "AG", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base32, "MZXW6=A=", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base32, "MZXW6====", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base32, "MZ1W6===", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base32, "MZXW6", BASEX_OK);
+  ASSERT_SAME_STATUS(Base64, "Zm9", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base64, "Z===", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base64, "Zm-v", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base64Url, "Zm+v", BASEX_SRCERROR);
+  ASSERT_SAME_STATUS(Base64Url, "Zm-v", BASEX_OK);
+}
+
+int main(void)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_cpp_encode);
+  RUN_TEST(test_fail_cpp_decode);
+  return UNITY_END();
+}
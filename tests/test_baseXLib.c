@@ -23,8 +23,14 @@
 
 #include "base16_converter.h"
 #include "base32_converter.h"
+#include "base64_converter.h"
 #include "base8_converter.h"
+#include "baseX_cpu.h"
+#include "baseX_ignore.h"
+#include "baseX_parallel.h"
 #include "unity.h"
+#include <ctype.h>
+#include <stdlib.h>
 #include <string.h>
 
 void setUp(void)
@@ -131,7 +137,108 @@ baseX_testData base32_data[] = {
      .byteStream = {0x00, 0x00, 0x00, 0x00, 0x00},
      .length = 5,
      .baseAsString = "AAAAAAAA",
-     .baseNumerical = {0, 0, 0, 0, 0, 0, 0, 0}}};
+     .baseNumerical = {0, 0, 0, 0, 0, 0, 0, 0}},
+    {// "fo"
+     .byteStream = {0x66, 0x6f},
+     .length = 2,
+     .baseAsString = "MZXQ====",
+     .baseNumerical = {12, 25, 23, 16}},
+    {// "foob"
+     .byteStream = {0x66, 0x6f, 0x6f, 0x62},
+     .length = 4,
+     .baseAsString = "MZXW6YQ=",
+     .baseNumerical = {12, 25, 23, 22, 30, 24, 16}},
+    {// "fooba"
+     .byteStream = {0x66, 0x6f, 0x6f, 0x62, 0x61},
+     .length = 5,
+     .baseAsString = "MZXW6YTB",
+     .baseNumerical = {12, 25, 23, 22, 30, 24, 19, 1}},
+    {// All one bytes
+     .byteStream = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+     .length = 6,
+     .baseAsString = "7777777774======",
+     .baseNumerical = {31, 31, 31, 31, 31, 31, 31, 31, 31, 28}}};
+
+baseX_testData base64_data[] = {
+    {.byteStream = {'f'},
+     .length = 1,
+     .baseAsString = "Zg==",
+     .baseNumerical = {25, 32}},
+    {.byteStream = {'f', 'o'},
+     .length = 2,
+     .baseAsString = "Zm8=",
+     .baseNumerical = {25, 38, 60}},
+    {.byteStream = {'f', 'o', 'o'},
+     .length = 3,
+     .baseAsString = "Zm9v",
+     .baseNumerical = {25, 38, 61, 47}},
+    {.byteStream = {'f', 'o', 'o', 'b', 'a', 'r'},
+     .length = 6,
+     .baseAsString = "Zm9vYmFy",
+     .baseNumerical = {25, 38, 61, 47, 24, 38, 5, 50}},
+    {.byteStream = {0xFB, 0xFF, 0xBF},
+     .length = 3,
+     .baseAsString = "+/+/",
+     .baseNumerical = {62, 63, 62, 63}}};
+
+#define LENGTH_TEST_SIZE (40) ///< Largest input of the length tests
+
+#define BATCH_TEST_ITEMS (200)    ///< Number of items of the batch tests
+#define BATCH_TEST_LONG (3000)    ///< Length of the long batch items
+#define BATCH_TEST_ARENA (100000) ///< Output size of the batch tests
+#define IGNORE_TEST_SIZE (300)    ///< Input of the tolerant decoder tests
+
+/**
+ * @brief Creates batch items of 0 to 40 bytes, every 50th item is long.
+ *
+ * @param[out] items The BATCH_TEST_ITEMS items.
+ * @param[out] bytes Input data of all items, BATCH_TEST_LONG bytes.
+ */
+static void batchItems(baseX_batchItem *items, uint8_t *bytes)
+{
+  srand(12);
+  for (uint32_t i = 0; i < BATCH_TEST_LONG; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t i = 0; i < BATCH_TEST_ITEMS; i++) {
+    items[i].data = bytes + i;
+    items[i].length = (i % 50 == 49) ? BATCH_TEST_LONG - i : (size_t)(i % 41);
+  }
+}
+
+#define LAYOUT_TEST_SIZE (6000) ///< Largest input of the layout tests
+
+/// Layouts of the layout tests, terminated by an empty layout
+const baseX_layout testLayouts[] = {
+    {.lineLength = 64, .lineSeparator = "\n"},
+    {.lineLength = 76, .lineSeparator = "\r\n"},
+    {.groupLength = 2, .groupSeparator = " "},
+    {.lineLength = 48, .lineSeparator = "\n", .groupLength = 8,
+     .groupSeparator = ""},
+    {.lineLength = 30, .lineSeparator = "\r\n", .groupLength = 3,
+     .groupSeparator = "-"},
+    {0}};
+
+/**
+ * @brief Inserts the separators of the layout into the encoded characters.
+ *
+ * @param[out] out The laid out characters, NULL-terminated.
+ * @param[in] plain Encoded characters without separators.
+ * @param[in] layout The layout.
+ */
+static void layoutReference(char *out, const char *plain,
+                            const baseX_layout *layout)
+{
+  for (size_t i = 0; plain[i]; i++) {
+    if (i && layout->lineLength && 0 == i % layout->lineLength) {
+      out = stpcpy(out, layout->lineSeparator);
+    } else if (i && layout->groupLength && 0 == i % layout->groupLength) {
+      out = stpcpy(out, layout->groupSeparator);
+    }
+    *out++ = plain[i];
+  }
+  *out = '\0';
+}
 
 void test_fail_base8_encode(void)
 {
@@ -139,6 +246,11 @@ void test_fail_base8_encode(void)
   TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_encodeBytes(buf, 0, NULL, 0));
   TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_encodeBytes(NULL, 0, buf, 0));
   TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base8_encodeBytes(buf, 0, buf, 1));
+  // Output lengths which wrap in 32 bit or are not representable at all
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base8_encodeBytes(buf, BUFFER_SIZE, buf, 0x20000000));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base8_encodeBytes(buf, SIZE_MAX, buf, SIZE_MAX));
 }
 
 void test_base8_encode(void)
@@ -157,7 +269,7 @@ void test_base8_encode(void)
 void test_fail_base8_decodeNum(void)
 {
   uint8_t buf[BUFFER_SIZE];
-  uint32_t decodedLength = 0;
+  size_t decodedLength = 0;
   TEST_ASSERT_EQUAL_INT(
       BASEX_ARGUMENTS,
       base8_decodeNum(buf, &decodedLength, BUFFER_SIZE, NULL, BUFFER_SIZE));
@@ -188,16 +300,73 @@ void test_fail_base8_decodeNum(void)
 void test_base8_decodeNum(void)
 {
   uint8_t buf[BUFFER_SIZE];
-  uint32_t decodedLength = 0;
+  size_t decodedLength = 0;
 
   for (uint32_t i = 0; i < sizeof(base8_data) / sizeof(base8_data[0]); i++) {
     TEST_ASSERT_EQUAL_INT(
         (int)BASEX_OK,
         (int)base8_decodeNum(
             buf, &decodedLength, BUFFER_SIZE, base8_data[i].baseNumerical,
-            (const uint32_t)strlen((const char *)base8_data[i].baseAsString)));
+            strlen((const char *)base8_data[i].baseAsString)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base8_data[i].byteStream, buf, decodedLength);
+  }
+}
+
+void test_fail_base8_decodeString(void)
+{
+  uint8_t buf[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_decodeString(NULL, &decodedLength,
+                                                            BUFFER_SIZE, "111"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base8_decodeString(buf, NULL, BUFFER_SIZE, "111"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_decodeString(buf, &decodedLength,
+                                                            BUFFER_SIZE, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base8_decodeString(buf, &decodedLength,
+                                                           BUFFER_SIZE, ""));
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "1111")); // Wrong length
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "73358043")); // Character not allowed
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "73358549")); // Character not allowed
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "73358543421")); // Not allowed in tail
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "412")); // Bit pattern wrong
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_SRCERROR, base8_decodeString(buf, &decodedLength, BUFFER_SIZE,
+                                         "624426")); // Bit pattern wrong
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base8_decodeString(buf, &decodedLength,
+                                                           2, "73358543"));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base8_decodeString(buf, &decodedLength, 3,
+                                           "73358543424"));
+}
+
+void test_base8_decodeString(void)
+{
+  uint8_t buf[BUFFER_SIZE];
+  size_t decodedLength = 0;
+
+  for (uint32_t i = 0; i < sizeof(base8_data) / sizeof(base8_data[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base8_decodeString(buf, &decodedLength,
+                                             base8_data[i].length,
+                                             base8_data[i].baseAsString));
+    TEST_ASSERT_EQUAL_size_t(base8_data[i].length, decodedLength);
     TEST_ASSERT_EQUAL_UINT8_ARRAY(base8_data[i].byteStream, buf, decodedLength);
   }
+  // Only the given length is decoded
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_decodeN(buf, &decodedLength,
+                                                BUFFER_SIZE, "2870", 3));
+  TEST_ASSERT_EQUAL_size_t(1, decodedLength);
+  TEST_ASSERT_EQUAL_HEX8(0x3F, buf[0]);
 }
 
 void test_fail_base8_stringToNum(void)
@@ -219,10 +388,292 @@ void test_base8_stringToNum(void)
                                   strlen(base8_data[i].baseAsString));
   }
 }
+void test_base8_stringToNumN(void)
+{
+  uint8_t buf[BUFFER_SIZE];
+  const char slice[] = {'6', '2', '4', '4', '2', '5', '0', '9'};
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_stringToNumN(buf, slice, 6));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base8_data[2].baseNumerical, buf, 6);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base8_stringToNumN(buf, slice, sizeof(slice)));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_stringToNumN(buf, slice, 0));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_stringToNumN(NULL, slice, 6));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_stringToNumN(buf, NULL, 6));
+}
+
+void test_base8_stream(void)
+{
+  uint8_t encoded[BUFFER_SIZE];
+  uint8_t decoded[BUFFER_SIZE];
+  size_t length = 0;
+  for (uint32_t i = 0; i < sizeof(base8_data) / sizeof(base8_data[0]); i++) {
+    // Feed the input byte by byte
+    base8_encodeContext encoder;
+    size_t pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeInit(&encoder));
+    for (uint32_t j = 0; j < base8_data[i].length; j++) {
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK, base8_encodeUpdate(&encoder, encoded + pos,
+                                       BUFFER_SIZE - pos, &length,
+                                       &base8_data[i].byteStream[j], 1));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base8_encodeFinal(&encoder, encoded + pos,
+                                            BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(strlen(base8_data[i].baseAsString), pos);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base8_data[i].baseAsString, encoded, pos);
+
+    // Feed the characters in chunks of 5
+    base8_decodeContext decoder;
+    size_t encodedLength = pos;
+    pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_decodeInit(&decoder));
+    for (size_t j = 0; j < encodedLength; j += 5) {
+      size_t chunk = encodedLength - j < 5 ? encodedLength - j : 5;
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK,
+          base8_decodeUpdate(&decoder, decoded + pos, BUFFER_SIZE - pos,
+                             &length, base8_data[i].baseAsString + j, chunk));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base8_decodeFinal(&decoder, decoded + pos,
+                                            BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(base8_data[i].length, pos);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base8_data[i].byteStream, decoded, pos);
+  }
+}
+
+void test_fail_base8_stream(void)
+{
+  uint8_t buf[BUFFER_SIZE];
+  size_t length = 0;
+  base8_encodeContext encoder;
+  base8_decodeContext decoder;
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_encodeInit(NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_decodeInit(NULL));
+  base8_encodeInit(&encoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base8_encodeUpdate(&encoder, buf, BUFFER_SIZE, &length,
+                                           NULL, 1));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base8_encodeUpdate(&encoder, buf, 7,
+                                                           &length, buf, 3));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeUpdate(&encoder, buf, 7, &length,
+                                                     buf, 2));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base8_encodeFinal(&encoder, buf, 5, &length));
+
+  base8_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base8_decodeFinal(&decoder, buf, BUFFER_SIZE, &length));
+  base8_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base8_decodeUpdate(&decoder, buf, BUFFER_SIZE, &length,
+                                           "1290", 4));
+  base8_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_decodeUpdate(&decoder, buf,
+                                                     BUFFER_SIZE, &length,
+                                                     "4211", 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, // Not allowed length
+                        base8_decodeFinal(&decoder, buf, BUFFER_SIZE, &length));
+  base8_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_decodeUpdate(&decoder, buf,
+                                                     BUFFER_SIZE, &length,
+                                                     "288", 3));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, // Wrong check bits
+                        base8_decodeFinal(&decoder, buf, BUFFER_SIZE, &length));
+}
+
+void test_base8_lengths(void)
+{
+  uint8_t bytes[LENGTH_TEST_SIZE];
+  uint8_t encoded[BASE8_ENCODED_LENGTH(LENGTH_TEST_SIZE) + 1];
+  uint8_t numbers[BASE8_ENCODED_LENGTH(LENGTH_TEST_SIZE)];
+  uint8_t decoded[BASE8_MAX_DECODED_LENGTH(sizeof(numbers))];
+  size_t decodedLength = 0;
+  memset(bytes, 0xA5, sizeof(bytes));
+  for (size_t length = 0; length <= LENGTH_TEST_SIZE; length++) {
+    size_t encodedLength = base8_encodedLength(length);
+    TEST_ASSERT_EQUAL_size_t(BASE8_ENCODED_LENGTH(length), encodedLength);
+    // The exact length plus NULL-terminator is sufficient
+    TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base8_encodeBytes(encoded,
+                                                            encodedLength,
+                                                            bytes, length));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeBytes(encoded,
+                                                      encodedLength + 1,
+                                                      bytes, length));
+    TEST_ASSERT_EQUAL_size_t(encodedLength, strlen((char *)encoded));
+    if (0 == length) {
+      continue;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base8_stringToNum(numbers, (char *)encoded));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base8_decodeNum(decoded, &decodedLength, length,
+                                          numbers, encodedLength));
+    TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+    TEST_ASSERT_EQUAL_size_t(length, base8_maxDecodedLength(encodedLength));
+    TEST_ASSERT_EQUAL_size_t(
+        length, base8_decodedLength((char *)encoded, encodedLength));
+  }
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX, base8_encodedLength(SIZE_MAX));
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX / 8 * 3 + 2,
+                           base8_maxDecodedLength(SIZE_MAX));
+}
+
+#define SIMD_TEST_SIZE (300)
+
+const uint32_t simdMasks[] = {BASEX_CPU_SSE41, UINT32_MAX};
+
+#define VALIDATE_TEST_SIZE (201) // The base32 encoding ends with padding
+
+const uint32_t validateMasks[] = {0, BASEX_CPU_SSE41, UINT32_MAX};
+
+void test_base8_simdMatchesScalar(void)
+{
+  uint8_t bytes[SIMD_TEST_SIZE];
+  uint8_t scalar[BASE8_ENCODED_LENGTH(SIMD_TEST_SIZE) + 1];
+  uint8_t simd[BASE8_ENCODED_LENGTH(SIMD_TEST_SIZE) + 1];
+  uint8_t numbers[BASE8_ENCODED_LENGTH(SIMD_TEST_SIZE)];
+  uint8_t decoded[SIMD_TEST_SIZE];
+  size_t decodedLength = 0;
+  const uint32_t masks[] = {BASEX_CPU_BMI2, BASEX_CPU_SSE41, BASEX_CPU_AVX2,
+                            UINT32_MAX};
+  srand(8);
+  for (uint32_t i = 0; i < SIMD_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t m = 0; m < sizeof(masks) / sizeof(masks[0]); m++) {
+    for (uint32_t length = 1; length <= SIMD_TEST_SIZE; length++) {
+      baseX_cpuSetMask(0);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeBytes(scalar, sizeof(scalar),
+                                                        bytes, length));
+      baseX_cpuSetMask(masks[m]);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeBytes(simd, sizeof(simd),
+                                                        bytes, length));
+      TEST_ASSERT_EQUAL_STRING((char *)scalar, (char *)simd);
+      size_t encodedLength = strlen((char *)simd);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base8_decodeN(decoded, &decodedLength,
+                                          SIMD_TEST_SIZE, (char *)simd,
+                                          encodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+
+      for (size_t j = 0; j < encodedLength; j++) {
+        numbers[j] = (uint8_t)(simd[j] - '1');
+      }
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base8_decodeNum(decoded, &decodedLength,
+                                            SIMD_TEST_SIZE, numbers,
+                                            encodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+
+      // Chunks of 13 characters split the groups at every position
+      base8_decodeContext decoder;
+      size_t pos = 0;
+      base8_decodeInit(&decoder);
+      for (size_t j = 0; j < encodedLength; j += 13) {
+        size_t chunk = encodedLength - j < 13 ? encodedLength - j : 13;
+        TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_decodeUpdate(
+                                            &decoder, decoded + pos,
+                                            SIMD_TEST_SIZE - pos,
+                                            &decodedLength,
+                                            (char *)simd + j, chunk));
+        pos += decodedLength;
+      }
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base8_decodeFinal(&decoder, decoded + pos,
+                                              SIMD_TEST_SIZE - pos,
+                                              &decodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, pos + decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+    }
+
+    // Every invalid digit has to be rejected at every group position
+    const char invalid[] = {'0', '9', '/', 'a', 0x11, (char)0xB1};
+    size_t encodedLength = strlen((char *)scalar);
+    for (uint32_t pos = 0; pos < encodedLength; pos += 5) {
+      for (uint32_t c = 0; c < sizeof(invalid); c++) {
+        uint8_t saved = scalar[pos];
+        scalar[pos] = (uint8_t)invalid[c];
+        TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                              base8_decodeN(decoded, &decodedLength,
+                                            SIMD_TEST_SIZE, (char *)scalar,
+                                            encodedLength));
+        scalar[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+}
+
+void test_base8_validate(void)
+{
+  uint8_t bytes[VALIDATE_TEST_SIZE];
+  uint8_t encoded[BASE8_ENCODED_LENGTH(VALIDATE_TEST_SIZE) + 1];
+  uint8_t decoded[VALIDATE_TEST_SIZE];
+  size_t decodedLength = 0;
+  size_t errorOffset = 0;
+  const char probes[] = {'1', '4', '8', '0', '9', ' ', (char)0xB1};
+  srand(22);
+  for (uint32_t i = 0; i < VALIDATE_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  // 200 bytes leave an incomplete group of 6 characters with 2 check bits
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_encodeBytes(encoded, sizeof(encoded),
+                                                    bytes,
+                                                    VALIDATE_TEST_SIZE - 1));
+  char *src = (char *)encoded;
+  size_t encodedLength = strlen(src);
+  for (uint32_t m = 0; m < sizeof(validateMasks) / sizeof(validateMasks[0]);
+       m++) {
+    baseX_cpuSetMask(validateMasks[m]);
+    // Every prefix is accepted exactly if it decodes
+    for (size_t length = 0; length <= encodedLength; length++) {
+      TEST_ASSERT_EQUAL_INT(base8_decodeN(decoded, &decodedLength,
+                                          sizeof(decoded), src, length),
+                            base8_validate(src, length, &errorOffset));
+    }
+    // Invalid digits are reported at their position, wrong check bits at
+    // the last character
+    for (size_t pos = 0; pos < encodedLength; pos += 3) {
+      for (uint32_t p = 0; p < sizeof(probes); p++) {
+        char saved = src[pos];
+        src[pos] = probes[p];
+        baseX_returnType expected = base8_decodeN(
+            decoded, &decodedLength, sizeof(decoded), src, encodedLength);
+        TEST_ASSERT_EQUAL_INT(expected,
+                              base8_validate(src, encodedLength, &errorOffset));
+        if (BASEX_OK != expected) {
+          size_t offset = ('1' <= probes[p] && probes[p] <= '8')
+                              ? encodedLength - 1
+                              : pos;
+          TEST_ASSERT_EQUAL_size_t(offset, errorOffset);
+        }
+        src[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base8_validate("42114", 5,
+                                                       &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(5, errorOffset); // Not allowed length
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base8_validate("", 0, &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(0, errorOffset);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base8_validate("111", 3, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base8_validate(NULL, 3, NULL));
+}
+
 void test_fail_base16_decodeString(void)
 {
   uint8_t decoded[BUFFER_SIZE];
-  uint32_t destLength;
+  size_t destLength;
   /* Argument errors*/
   TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base16_decodeString(NULL, &destLength,
                                                              BUFFER_SIZE, "2"));
@@ -251,20 +702,185 @@ void test_fail_base16_decodeString(void)
 void test_base16_decodeString(void)
 {
   uint8_t decoded[BUFFER_SIZE];
-  uint32_t decodedLength = 0;
+  size_t decodedLength = 0;
   for (uint32_t i = 0; i < sizeof(base16_data) / sizeof(base16_data[0]); i++) {
     TEST_ASSERT_EQUAL_INT(
         BASEX_OK, base16_decodeString(decoded, &decodedLength, BUFFER_SIZE,
                                       base16_data[i].baseAsString));
     TEST_ASSERT_EQUAL_UINT8_ARRAY(base16_data[i].byteStream, decoded,
                                   base16_data[i].length);
-    TEST_ASSERT_EQUAL_UINT32(base16_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_size_t(base16_data[i].length, decodedLength);
   }
   TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeString(decoded, &decodedLength,
                                                       BUFFER_SIZE, "ff"));
   const uint8_t lowData[] = {0xff};
   TEST_ASSERT_EQUAL_UINT8_ARRAY(lowData, decoded, 1);
-  TEST_ASSERT_EQUAL_UINT32(1, decodedLength);
+  TEST_ASSERT_EQUAL_size_t(1, decodedLength);
+}
+
+void test_base16_decodeN(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  const char slice[] = {'4', '8', '6', '5', '6', 'C', '6', 'C', '6', 'F', 'X'};
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeN(decoded, &decodedLength,
+                                                 BUFFER_SIZE, slice, 10));
+  TEST_ASSERT_EQUAL_size_t(5, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base16_data[0].byteStream, decoded, 5);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       "00\0" "000", 6)); // Embedded NULL
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base16_decodeN(decoded, &decodedLength,
+                                                       BUFFER_SIZE, slice, 0));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       NULL, 10));
+}
+
+void test_base16_decodeConstantTime(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  for (size_t i = 0; i < sizeof(base16_data) / sizeof(base16_data[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(
+        BASEX_OK, base16_decodeConstantTime(
+                      decoded, &decodedLength, BUFFER_SIZE,
+                      base16_data[i].baseAsString,
+                      strlen(base16_data[i].baseAsString)));
+    TEST_ASSERT_EQUAL_size_t(base16_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base16_data[i].byteStream, decoded,
+                                  decodedLength);
+  }
+  // Every character is accepted like by the fast decoder
+  for (int c = 0; c < 256; c++) {
+    char src[2] = {'0', (char)c};
+    uint8_t expected = 0;
+    baseX_returnType ret =
+        base16_decodeN(&expected, &decodedLength, 1, src, sizeof(src));
+    TEST_ASSERT_EQUAL_INT(ret, base16_decodeConstantTime(
+                                   decoded, &decodedLength, 1, src,
+                                   sizeof(src)));
+    if (BASEX_OK == ret) {
+      TEST_ASSERT_EQUAL_UINT8(expected, decoded[0]);
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeConstantTime(
+                                      decoded, &decodedLength, BUFFER_SIZE,
+                                      "deadBEEF", 8));
+  TEST_ASSERT_EQUAL_UINT8(0xEF, decoded[3]);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_decodeConstantTime(NULL, &decodedLength,
+                                                  BUFFER_SIZE, "00", 2));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeConstantTime(decoded, &decodedLength,
+                                                  BUFFER_SIZE, "", 0));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeConstantTime(decoded, &decodedLength,
+                                                  BUFFER_SIZE, "ABC", 3));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeConstantTime(decoded, &decodedLength,
+                                                  BUFFER_SIZE, "G0AB", 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_decodeConstantTime(decoded, &decodedLength, 1,
+                                                  "ABCD", 4));
+}
+
+void test_base16_decodeIgnore(void)
+{
+  const uint8_t expected[] = {0xDE, 0xAD, 0xBE, 0xEF};
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  const char *inputs[] = {"DEADBEEF", "DE AD BE EF", "DEAD\r\nBEEF\r\n",
+                          " D E A D B E E F ", "\tDEADBEE\nF"};
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_decodeIgnore(decoded, &decodedLength,
+                                              sizeof(decoded), inputs[i],
+                                              strlen(inputs[i]),
+                                              &baseX_whitespace));
+    TEST_ASSERT_EQUAL_size_t(sizeof(expected), decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, decoded, sizeof(expected));
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "DE:AD", 5,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "DE AD B", 7,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), " \n ", 3,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_decodeIgnore(decoded, &decodedLength, 3,
+                                            "DE AD BE EF", 11,
+                                            &baseX_whitespace));
+
+  // Custom set: colons between the pairs
+  baseX_ignoreSet colons;
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, baseX_ignoreInit(&colons, ":"));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeIgnore(
+                                      decoded, &decodedLength, sizeof(decoded),
+                                      "de:ad:be:ef", 11, &colons));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, decoded, sizeof(expected));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "DEAD", 4, NULL));
+}
+
+void test_base16_validate(void)
+{
+  uint8_t bytes[VALIDATE_TEST_SIZE];
+  char encoded[BASE16_ENCODED_LENGTH(VALIDATE_TEST_SIZE) + 1];
+  uint8_t decoded[VALIDATE_TEST_SIZE];
+  size_t decodedLength = 0;
+  size_t errorOffset = 0;
+  const char probes[] = {'0', 'f', 'G', '/', ':', '`', ' ', (char)0xC6};
+  srand(23);
+  for (uint32_t i = 0; i < VALIDATE_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(encoded, sizeof(encoded),
+                                                     bytes,
+                                                     VALIDATE_TEST_SIZE));
+  size_t encodedLength = strlen(encoded);
+  for (uint32_t m = 0; m < sizeof(validateMasks) / sizeof(validateMasks[0]);
+       m++) {
+    baseX_cpuSetMask(validateMasks[m]);
+    // Every prefix is accepted exactly if it decodes
+    for (size_t length = 0; length <= encodedLength; length++) {
+      TEST_ASSERT_EQUAL_INT(base16_decodeN(decoded, &decodedLength,
+                                           sizeof(decoded), encoded, length),
+                            base16_validate(encoded, length, &errorOffset));
+    }
+    // An invalid character is reported at its position in every block
+    for (size_t pos = 0; pos < encodedLength; pos += 3) {
+      for (uint32_t p = 0; p < sizeof(probes); p++) {
+        char saved = encoded[pos];
+        encoded[pos] = probes[p];
+        baseX_returnType expected = base16_decodeN(
+            decoded, &decodedLength, sizeof(decoded), encoded, encodedLength);
+        TEST_ASSERT_EQUAL_INT(expected, base16_validate(encoded, encodedLength,
+                                                        &errorOffset));
+        if (BASEX_OK != expected) {
+          TEST_ASSERT_EQUAL_size_t(pos, errorOffset);
+        }
+        encoded[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base16_validate("ABC", 3,
+                                                        &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(3, errorOffset); // Odd number of characters
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base16_validate("", 0, &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(0, errorOffset);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_validate("dEaD", 4, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base16_validate(NULL, 4, NULL));
 }
 
 void test_fail_base16_encodeBytes(void)
@@ -285,6 +901,14 @@ void test_fail_base16_encodeBytes(void)
                         base16_encodeBytes(decoded, 1,
                                            (const uint8_t *)correctString,
                                            (uint32_t)strlen(correctString)));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_encodeBytes(decoded, BUFFER_SIZE,
+                                           (const uint8_t *)correctString,
+                                           0x80000000));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_encodeBytes(decoded, SIZE_MAX,
+                                           (const uint8_t *)correctString,
+                                           SIZE_MAX / 2 + 1));
   return;
 }
 
@@ -303,10 +927,378 @@ void test_base16_encodeBytes(void)
   }
 }
 
+void test_base16_alphabet(void)
+{
+  uint8_t bytes[BUFFER_SIZE];
+  char upper[2 * BUFFER_SIZE + 1];
+  char lower[2 * BUFFER_SIZE + 1];
+  for (size_t i = 0; i < sizeof(bytes); i++) {
+    bytes[i] = (uint8_t)(i * 151 + 7);
+  }
+  // Lengths around the vector block sizes
+  for (size_t length = 0; length <= sizeof(bytes); length++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(upper, sizeof(upper),
+                                                       bytes, length));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_encodeBytesAlphabet(lower, sizeof(lower),
+                                                     bytes, length,
+                                                     &base16_lowerAlphabet));
+    TEST_ASSERT_EQUAL_size_t(strlen(upper), strlen(lower));
+    for (size_t i = 0; i < 2 * length; i++) {
+      TEST_ASSERT_EQUAL_CHAR(tolower(upper[i]), lower[i]);
+    }
+  }
+
+  base16_alphabet custom;
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base16_alphabetInit(&custom, "0123456789abcdef"));
+  TEST_ASSERT_EQUAL_MEMORY(&base16_lowerAlphabet, &custom, sizeof(custom));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base16_alphabetInit(&custom, "ghijklmnopqrstuv"));
+  for (uint32_t features = 0; features <= BASEX_CPU_AVX2; features++) {
+    baseX_cpuSetMask(features);
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_encodeBytesAlphabet(lower, sizeof(lower),
+                                                     bytes, sizeof(bytes),
+                                                     &custom));
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+      TEST_ASSERT_EQUAL_CHAR('g' + (bytes[i] >> 4), lower[2 * i]);
+      TEST_ASSERT_EQUAL_CHAR('g' + (bytes[i] & 0xF), lower[2 * i + 1]);
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_alphabetInit(&custom, "0123456789abcdea"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_alphabetInit(&custom, "0123456789abcde"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base16_alphabetInit(NULL, "0"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base16_alphabetInit(&custom, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_encodeBytesAlphabet(lower, sizeof(lower),
+                                                   bytes, 1, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_encodeBytesAlphabet(lower, 2, bytes, 1,
+                                                   &base16_lowerAlphabet));
+}
+
+void test_base16_layout(void)
+{
+  const uint8_t fingerprint[] = {0xDE, 0xAD, 0xBE, 0xEF};
+  const baseX_layout colons = {.groupLength = 2, .groupSeparator = ":"};
+  char encoded[BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_size_t(11, base16_encodedLengthLayout(4, &colons));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base16_encodeBytesLayout(encoded, 12, fingerprint, 4,
+                                                 &base16_lowerAlphabet,
+                                                 &colons));
+  TEST_ASSERT_EQUAL_STRING("de:ad:be:ef", encoded);
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_encodeBytesLayout(encoded, 11, fingerprint, 4,
+                                                 &base16_lowerAlphabet,
+                                                 &colons));
+
+  static uint8_t bytes[LAYOUT_TEST_SIZE];
+  static char plain[BASE16_ENCODED_LENGTH(LAYOUT_TEST_SIZE) + 1];
+  static char expected[2 * sizeof(plain)];
+  static char output[2 * sizeof(plain)];
+  srand(20);
+  for (size_t i = 0; i < LAYOUT_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (const baseX_layout *layout = testLayouts; layout->lineLength ||
+                                                  layout->groupLength;
+       layout++) {
+    for (size_t length = 0; length <= LAYOUT_TEST_SIZE;
+         length += 1 + length / 4) {
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(plain, sizeof(plain),
+                                                         bytes, length));
+      layoutReference(expected, plain, layout);
+      size_t expectedLength = strlen(expected);
+      TEST_ASSERT_EQUAL_size_t(expectedLength,
+                               base16_encodedLengthLayout(length, layout));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytesLayout(
+                                          output, expectedLength + 1, bytes,
+                                          length, &base16_upperAlphabet,
+                                          layout));
+      TEST_ASSERT_EQUAL_STRING(expected, output);
+      TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base16_encodeBytesLayout(
+                                                output, expectedLength, bytes,
+                                                length, &base16_upperAlphabet,
+                                                layout));
+    }
+  }
+
+  // The line length has to be a multiple of the group length
+  const baseX_layout invalid[] = {
+      {.lineLength = 10, .lineSeparator = "\n", .groupLength = 4,
+       .groupSeparator = " "},
+      {.lineLength = 10},
+      {.groupLength = 2}};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    TEST_ASSERT_EQUAL_size_t(SIZE_MAX, base16_encodedLengthLayout(4,
+                                                                  &invalid[i]));
+    TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                          base16_encodeBytesLayout(encoded, BUFFER_SIZE,
+                                                   fingerprint, 4,
+                                                   &base16_upperAlphabet,
+                                                   &invalid[i]));
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_encodeBytesLayout(encoded, BUFFER_SIZE,
+                                                 fingerprint, 4,
+                                                 &base16_upperAlphabet, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_encodeBytesLayout(NULL, BUFFER_SIZE,
+                                                 fingerprint, 4,
+                                                 &base16_upperAlphabet,
+                                                 &colons));
+}
+
+void test_base16_stream(void)
+{
+  char encoded[BUFFER_SIZE];
+  uint8_t decoded[BUFFER_SIZE];
+  size_t length = 0;
+  for (uint32_t i = 0; i < sizeof(base16_data) / sizeof(base16_data[0]); i++) {
+    base16_encodeContext encoder;
+    size_t pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeInit(&encoder));
+    for (uint32_t j = 0; j < base16_data[i].length; j += 3) {
+      uint32_t chunk =
+          base16_data[i].length - j < 3 ? base16_data[i].length - j : 3;
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK, base16_encodeUpdate(&encoder, encoded + pos,
+                                        BUFFER_SIZE - pos, &length,
+                                        &base16_data[i].byteStream[j], chunk));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_encodeFinal(&encoder, encoded + pos,
+                                             BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(strlen(base16_data[i].baseAsString), pos);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(base16_data[i].baseAsString, encoded, pos);
+
+    // Odd chunks split the bytes between two calls
+    base16_decodeContext decoder;
+    size_t encodedLength = pos;
+    pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeInit(&decoder));
+    for (size_t j = 0; j < encodedLength; j += 3) {
+      size_t chunk = encodedLength - j < 3 ? encodedLength - j : 3;
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK,
+          base16_decodeUpdate(&decoder, decoded + pos, BUFFER_SIZE - pos,
+                              &length, base16_data[i].baseAsString + j, chunk));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_decodeFinal(&decoder, decoded + pos,
+                                             BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(base16_data[i].length, pos);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base16_data[i].byteStream, decoded, pos);
+  }
+
+  base16_decodeContext decoder;
+  base16_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base16_decodeUpdate(&decoder, decoded,
+                                                            1, &length,
+                                                            "ABCD", 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeUpdate(&decoder, decoded, BUFFER_SIZE,
+                                            &length, "ABX", 3));
+  base16_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeUpdate(&decoder, decoded,
+                                                      BUFFER_SIZE, &length,
+                                                      "ABC", 3));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, // Odd number of characters
+                        base16_decodeFinal(&decoder, decoded, BUFFER_SIZE,
+                                           &length));
+}
+
+void test_base16_simdMatchesScalar(void)
+{
+  uint8_t bytes[SIMD_TEST_SIZE];
+  char scalar[2 * SIMD_TEST_SIZE + 1];
+  char simd[2 * SIMD_TEST_SIZE + 1];
+  uint8_t decoded[SIMD_TEST_SIZE];
+  size_t decodedLength = 0;
+  srand(16);
+  for (uint32_t i = 0; i < SIMD_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t m = 0; m < sizeof(simdMasks) / sizeof(simdMasks[0]); m++) {
+    for (uint32_t length = 1; length <= SIMD_TEST_SIZE; length++) {
+      baseX_cpuSetMask(0);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(scalar, sizeof(scalar),
+                                                         bytes, length));
+      baseX_cpuSetMask(simdMasks[m]);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(simd, sizeof(simd),
+                                                         bytes, length));
+      TEST_ASSERT_EQUAL_STRING(scalar, simd);
+
+      // Mixed case input has to decode to the same bytes
+      for (uint32_t i = 0; i < 2 * length; i += 3) {
+        if ('A' <= simd[i] && simd[i] <= 'F') {
+          simd[i] = (char)(simd[i] - 'A' + 'a');
+        }
+      }
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base16_decodeString(decoded, &decodedLength,
+                                                SIMD_TEST_SIZE, simd));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+    }
+
+    // Every invalid character has to be rejected at every block position
+    const char invalid[] = {'/', ':', '@', 'G', '`', 'g', 0x10, (char)0xC1};
+    for (uint32_t pos = 0; pos < 2 * SIMD_TEST_SIZE; pos += 7) {
+      for (uint32_t c = 0; c < sizeof(invalid); c++) {
+        char saved = scalar[pos];
+        scalar[pos] = invalid[c];
+        TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                              base16_decodeString(decoded, &decodedLength,
+                                                  SIMD_TEST_SIZE, scalar));
+        scalar[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+}
+
+void test_base16_lengths(void)
+{
+  uint8_t bytes[LENGTH_TEST_SIZE];
+  char encoded[BASE16_ENCODED_LENGTH(LENGTH_TEST_SIZE) + 1];
+  uint8_t decoded[BASE16_MAX_DECODED_LENGTH(sizeof(encoded))];
+  size_t decodedLength = 0;
+  memset(bytes, 0xA5, sizeof(bytes));
+  for (size_t length = 1; length <= LENGTH_TEST_SIZE; length++) {
+    size_t encodedLength = base16_encodedLength(length);
+    TEST_ASSERT_EQUAL_size_t(BASE16_ENCODED_LENGTH(length), encodedLength);
+    TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                          base16_encodeBytes(encoded, encodedLength, bytes,
+                                             length));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(encoded,
+                                                       encodedLength + 1,
+                                                       bytes, length));
+    TEST_ASSERT_EQUAL_size_t(encodedLength, strlen(encoded));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_decodeN(decoded, &decodedLength, length,
+                                         encoded, encodedLength));
+    TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+    TEST_ASSERT_EQUAL_size_t(length, base16_maxDecodedLength(encodedLength));
+    TEST_ASSERT_EQUAL_size_t(length,
+                             base16_decodedLength(encoded, encodedLength));
+  }
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX, base16_encodedLength(SIZE_MAX / 2 + 1));
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX - 1, base16_encodedLength(SIZE_MAX / 2));
+}
+
+void test_base16_batch(void)
+{
+  uint8_t bytes[BATCH_TEST_LONG];
+  baseX_batchItem items[BATCH_TEST_ITEMS];
+  baseX_batchItem encodedItems[BATCH_TEST_ITEMS];
+  size_t offsets[BATCH_TEST_ITEMS + 1];
+  size_t decodedOffsets[BATCH_TEST_ITEMS + 1];
+  char *arena = malloc(BATCH_TEST_ARENA);
+  char *expected = malloc(2 * BATCH_TEST_LONG + 1);
+  uint8_t *decoded = malloc(BATCH_TEST_ARENA);
+  TEST_ASSERT_NOT_NULL(arena);
+  TEST_ASSERT_NOT_NULL(expected);
+  TEST_ASSERT_NOT_NULL(decoded);
+  batchItems(items, bytes);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base16_encodeBatch(arena, BATCH_TEST_ARENA, offsets,
+                                           items, BATCH_TEST_ITEMS));
+  size_t decodeCount = 0;
+  for (uint32_t i = 0; i < BATCH_TEST_ITEMS; i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base16_encodeBytes(expected, 2 * BATCH_TEST_LONG + 1,
+                                             items[i].data, items[i].length));
+    TEST_ASSERT_EQUAL_size_t(strlen(expected), offsets[i + 1] - offsets[i]);
+    if (items[i].length) { // Empty items are not decodable
+      TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, arena + offsets[i],
+                                   offsets[i + 1] - offsets[i]);
+      encodedItems[decodeCount].data = arena + offsets[i];
+      encodedItems[decodeCount].length = offsets[i + 1] - offsets[i];
+      decodeCount++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base16_decodeBatch(decoded, BATCH_TEST_ARENA,
+                                           decodedOffsets, encodedItems,
+                                           decodeCount, NULL));
+  for (uint32_t i = 0, j = 0; i < BATCH_TEST_ITEMS; i++) {
+    if (items[i].length) {
+      TEST_ASSERT_EQUAL_size_t(items[i].length,
+                               decodedOffsets[j + 1] - decodedOffsets[j]);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(items[i].data, decoded + decodedOffsets[j],
+                                    items[i].length);
+      j++;
+    }
+  }
+  free(arena);
+  free(expected);
+  free(decoded);
+}
+
+void test_fail_base16_batch(void)
+{
+  uint8_t bytes[BATCH_TEST_LONG];
+  baseX_batchItem items[BATCH_TEST_ITEMS];
+  size_t offsets[BATCH_TEST_ITEMS + 1];
+  uint8_t decoded[BUFFER_SIZE];
+  size_t errorItem = 0;
+  batchItems(items, bytes);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_encodeBatch(NULL, BATCH_TEST_ARENA, offsets,
+                                           items, BATCH_TEST_ITEMS));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_encodeBatch((char *)decoded, BUFFER_SIZE, NULL,
+                                           items, BATCH_TEST_ITEMS));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base16_encodeBatch((char *)decoded, BUFFER_SIZE,
+                                           offsets, items, BATCH_TEST_ITEMS));
+
+  baseX_batchItem hexItems[] = {{"00", 2}, {"0A0B", 4}, {"0G", 2}, {"FF", 2}};
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeBatch(decoded, BUFFER_SIZE, offsets,
+                                           hexItems, 4, &errorItem));
+  TEST_ASSERT_EQUAL_size_t(2, errorItem);
+  hexItems[2].length = 1;
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeBatch(decoded, BUFFER_SIZE, offsets,
+                                           hexItems, 4, &errorItem));
+  TEST_ASSERT_EQUAL_size_t(2, errorItem);
+  hexItems[2].length = 0;
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeBatch(decoded, BUFFER_SIZE, offsets,
+                                           hexItems, 4, &errorItem));
+  hexItems[2].data = NULL;
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_decodeBatch(decoded, BUFFER_SIZE, offsets,
+                                           hexItems, 4, &errorItem));
+  hexItems[2] = (baseX_batchItem){"0a", 2};
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base16_decodeBatch(decoded, 4, offsets,
+                                                           hexItems, 4, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_decodeBatch(decoded, 5, offsets,
+                                                     hexItems, 4, NULL));
+  const uint8_t expected[] = {0x00, 0x0A, 0x0B, 0x0A, 0xFF};
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, decoded, sizeof(expected));
+  TEST_ASSERT_EQUAL_size_t(5, offsets[4]);
+}
+
 void test_fail_base32_decodeString(void)
 {
   uint8_t decoded[BUFFER_SIZE];
-  uint32_t destLength;
+  size_t destLength;
   TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base32_decodeString(NULL, &destLength,
                                                              BUFFER_SIZE, "2"));
   TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
@@ -349,15 +1341,495 @@ void test_fail_base32_decodeString(void)
 void test_base32_decodeString(void)
 {
   uint8_t decoded[BUFFER_SIZE];
-  uint32_t decodedLength = 0;
+  size_t decodedLength = 0;
   for (uint32_t i = 0; i < sizeof(base32_data) / sizeof(base32_data[0]); i++) {
     TEST_ASSERT_EQUAL_INT(
         BASEX_OK, base32_decodeString(decoded, &decodedLength, BUFFER_SIZE,
                                       base32_data[i].baseAsString));
     TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[i].byteStream, decoded,
                                   base32_data[i].length);
-    TEST_ASSERT_EQUAL_UINT32(base32_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_size_t(base32_data[i].length, decodedLength);
+  }
+}
+
+void test_base32_decodeN(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  const char *message = "MZXW6YTBOI======MZXW6===";
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeN(decoded, &decodedLength,
+                                                 BUFFER_SIZE, message, 16));
+  TEST_ASSERT_EQUAL_size_t(6, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[2].byteStream, decoded, 6);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       message + 16, 8));
+  TEST_ASSERT_EQUAL_size_t(3, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[1].byteStream, decoded, 3);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       message, 24)); // Padding in between
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       "MZ\0W", 4)); // Embedded NULL
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       NULL, 4));
+}
+
+void test_base32_decodeLowerCase(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  const uint8_t expected[] = {0x66, 0x6f, 0x6f, 0x62, 0x61, 0x72};
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeString(decoded, &decodedLength,
+                                            BUFFER_SIZE, "mzXw6yTbOi======"));
+  TEST_ASSERT_EQUAL_size_t(sizeof(expected), decodedLength);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, decoded, sizeof(expected));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeString(decoded, &decodedLength,
+                                            BUFFER_SIZE, "MZXW6YT{")); // '{'
+}
+
+void test_base32_decodeConstantTime(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  for (size_t i = 0; i < sizeof(base32_data) / sizeof(base32_data[0]); i++) {
+    const char *src = base32_data[i].baseAsString;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_decodeConstantTime(decoded, &decodedLength,
+                                                    BUFFER_SIZE, src,
+                                                    strlen(src)));
+    TEST_ASSERT_EQUAL_size_t(base32_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[i].byteStream, decoded,
+                                  decodedLength);
+    // Without padding
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeConstantTime(
+                                        decoded, &decodedLength, BUFFER_SIZE,
+                                        src, strcspn(src, "=")));
+    TEST_ASSERT_EQUAL_size_t(base32_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[i].byteStream, decoded,
+                                  decodedLength);
+  }
+  // Every character is accepted like by the fast decoder
+  for (int c = 0; c < 256; c++) {
+    char src[8] = {'A', 'A', 'A', 'A', 'A', 'A', 'A', (char)c};
+    uint8_t expected[BASE32_GROUP_BYTES];
+    baseX_returnType ret = base32_decodeN(expected, &decodedLength,
+                                          sizeof(expected), src, sizeof(src));
+    if ('=' == c) {
+      continue; // Padding at the end of a full group
+    }
+    TEST_ASSERT_EQUAL_INT(ret, base32_decodeConstantTime(
+                                   decoded, &decodedLength, BUFFER_SIZE, src,
+                                   sizeof(src)));
+    if (BASEX_OK == ret) {
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, decoded, sizeof(expected));
+    }
   }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeConstantTime(
+                                      decoded, &decodedLength, BUFFER_SIZE,
+                                      "mzXw6yTbOi======", 16));
+  TEST_ASSERT_EQUAL_size_t(6, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8(0x72, decoded[5]);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_decodeConstantTime(decoded, NULL, BUFFER_SIZE,
+                                                  "MY======", 8));
+  const char *invalid[] = {"",          "========",  "MZXW6==",
+                           "MZXW6====", "MZX",       "MZXW6Y",
+                           "M=======",  "MZXW6=A=",  "MZXW6YTBOI=======",
+                           "MZ1W6==="};
+  for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                          base32_decodeConstantTime(decoded, &decodedLength,
+                                                    BUFFER_SIZE, invalid[i],
+                                                    strlen(invalid[i])));
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_decodeConstantTime(decoded, &decodedLength, 2,
+                                                  "MZXW6===", 8));
+}
+
+void test_base32_decodeIgnore(void)
+{
+  uint8_t bytes[IGNORE_TEST_SIZE];
+  char encoded[BASE32_ENCODED_LENGTH(IGNORE_TEST_SIZE) + 1];
+  char wrapped[3 * sizeof(encoded)]; // CRLF after every character
+  uint8_t decoded[IGNORE_TEST_SIZE];
+  size_t decodedLength = 0;
+  srand(19);
+  for (size_t i = 0; i < IGNORE_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytes(encoded, sizeof(encoded),
+                                                     bytes, IGNORE_TEST_SIZE));
+  size_t encodedLength = strlen(encoded);
+
+  // Wrapped at 76 and at every other line length, with LF and CRLF
+  for (uint32_t m = 0; m < sizeof(simdMasks) / sizeof(simdMasks[0]); m++) {
+    baseX_cpuSetMask(simdMasks[m]);
+    for (size_t column = 1; column <= 80; column++) {
+      size_t length = 0;
+      for (size_t i = 0; i < encodedLength; i++) {
+        wrapped[length++] = encoded[i];
+        if (0 == (i + 1) % column) {
+          if (column & 1) {
+            wrapped[length++] = '\r';
+          }
+          wrapped[length++] = '\n';
+        }
+      }
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base32_decodeIgnore(decoded, &decodedLength,
+                                                sizeof(decoded), wrapped,
+                                                length, &baseX_whitespace));
+      TEST_ASSERT_EQUAL_size_t(IGNORE_TEST_SIZE, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, IGNORE_TEST_SIZE);
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "MZXW 6===\n", 10,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_size_t(3, decodedLength);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("foo", decoded, 3);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "MZXW6===\nMZ",
+                                            11, &baseX_whitespace));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeIgnore(decoded, &decodedLength,
+                                            sizeof(decoded), "MZXW\n6-==", 9,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_decodeIgnore(decoded, &decodedLength, 4,
+                                            "MZXW\n6YTB", 9,
+                                            &baseX_whitespace));
+  // Wrapped padding fits an exact buffer like in base32_decodeN()
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeIgnore(decoded, &decodedLength, 6,
+                                            "MZXW6YTB\nOI======", 17,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_size_t(6, decodedLength);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("foobar", decoded, 6);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeIgnore(decoded, &decodedLength, 3,
+                                            "MZXW6===\r\n", 10,
+                                            &baseX_whitespace));
+  TEST_ASSERT_EQUAL_size_t(3, decodedLength);
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_decodeIgnore(decoded, &decodedLength, 5,
+                                            "MZXW6YTB\nOI======", 17,
+                                            &baseX_whitespace));
+}
+
+void test_base32_validate(void)
+{
+  const base32_alphabet *alphabets[] = {&base32_rfcAlphabet,
+                                        &base32_hexAlphabet, &base32_zAlphabet};
+  uint8_t bytes[VALIDATE_TEST_SIZE];
+  char encoded[BASE32_ENCODED_LENGTH(VALIDATE_TEST_SIZE) + 1];
+  uint8_t decoded[VALIDATE_TEST_SIZE + 1]; // Room behind the last byte
+  size_t decodedLength = 0;
+  size_t errorOffset = 0;
+  const char probes[] = {'a', '7', '0', '1', '8', '@', '[', ' ', (char)0xC1};
+  srand(24);
+  for (uint32_t i = 0; i < VALIDATE_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t m = 0; m < sizeof(validateMasks) / sizeof(validateMasks[0]);
+       m++) {
+    baseX_cpuSetMask(validateMasks[m]);
+    for (uint32_t a = 0; a < sizeof(alphabets) / sizeof(alphabets[0]); a++) {
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesAlphabet(
+                                          encoded, sizeof(encoded), bytes,
+                                          VALIDATE_TEST_SIZE, alphabets[a]));
+      size_t encodedLength = strlen(encoded);
+      // Every prefix is accepted exactly if it decodes, also with missing or
+      // surplus padding
+      encoded[encodedLength] = '=';
+      for (size_t length = 0; length <= encodedLength + 1; length++) {
+        TEST_ASSERT_EQUAL_INT(
+            base32_decodeNAlphabet(decoded, &decodedLength, sizeof(decoded),
+                                   encoded, length, alphabets[a]),
+            base32_validateAlphabet(encoded, length, &errorOffset,
+                                    alphabets[a]));
+      }
+      encoded[encodedLength] = '\0';
+    }
+
+    // An invalid character before the padding is reported at its position
+    base32_encodeBytes(encoded, sizeof(encoded), bytes, VALIDATE_TEST_SIZE);
+    size_t dataLength = strcspn(encoded, "=");
+    size_t encodedLength = strlen(encoded);
+    for (size_t pos = 0; pos < encodedLength; pos += 3) {
+      for (uint32_t p = 0; p < sizeof(probes); p++) {
+        char saved = encoded[pos];
+        encoded[pos] = probes[p];
+        baseX_returnType expected = base32_decodeN(
+            decoded, &decodedLength, sizeof(decoded), encoded, encodedLength);
+        TEST_ASSERT_EQUAL_INT(expected, base32_validate(encoded, encodedLength,
+                                                        &errorOffset));
+        if (BASEX_OK != expected && pos < dataLength) {
+          TEST_ASSERT_EQUAL_size_t(pos, errorOffset);
+        }
+        encoded[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_validate("MZXW6===", 8, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_validate("mzxw6", 5, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base32_validate("MZXW6====", 9,
+                                                        &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(8, errorOffset); // Surplus padding
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base32_validate("MZ=W6===", 8,
+                                                        &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(3, errorOffset); // Data after the padding
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, base32_validate("", 0, &errorOffset));
+  TEST_ASSERT_EQUAL_size_t(0, errorOffset);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_validateAlphabet("MZXW6===", 8, &errorOffset,
+                                                &base32_zAlphabet));
+  TEST_ASSERT_EQUAL_size_t(5, errorOffset); // z-base-32 has no padding
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base32_validate(NULL, 8, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_validateAlphabet("MZXW6===", 8, NULL, NULL));
+}
+
+void test_base32_alphabets(void)
+{
+  const uint8_t foobar[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+  const struct {
+    const base32_alphabet *alphabet;
+    const char *encoded;
+    const char *alias; // Different spelling of the same bytes
+  } vectors[] = {
+      {&base32_rfcAlphabet, "MZXW6YTBOI======", "mzxw6ytboi"},
+      {&base32_hexAlphabet, "CPNMUOJ1E8======", "cpnmuoj1e8"},
+      {&base32_crockfordAlphabet, "CSQPYRK1E8", "csqpyrkie8"},
+      {&base32_zAlphabet, "c3zs6aubqe", "C3ZS6AUBQE"}};
+  char encoded[BUFFER_SIZE];
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+    const base32_alphabet *alphabet = vectors[i].alphabet;
+    size_t length = strlen(vectors[i].encoded);
+    TEST_ASSERT_EQUAL_size_t(
+        length, base32_encodedLengthAlphabet(sizeof(foobar), alphabet));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesAlphabet(
+                                        encoded, length + 1, foobar,
+                                        sizeof(foobar), alphabet));
+    TEST_ASSERT_EQUAL_STRING(vectors[i].encoded, encoded);
+    TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base32_encodeBytesAlphabet(
+                                              encoded, length, foobar,
+                                              sizeof(foobar), alphabet));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_decodeNAlphabet(decoded, &decodedLength,
+                                                 sizeof(decoded), encoded,
+                                                 length, alphabet));
+    TEST_ASSERT_EQUAL_size_t(sizeof(foobar), decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(foobar, decoded, sizeof(foobar));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeNAlphabet(
+                                        decoded, &decodedLength,
+                                        sizeof(decoded), vectors[i].alias,
+                                        strlen(vectors[i].alias), alphabet));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(foobar, decoded, sizeof(foobar));
+  }
+  // Crockford reads O as 0 and L as 1, unpadded alphabets reject padding
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeNAlphabet(
+                                      decoded, &decodedLength, BUFFER_SIZE,
+                                      "OL", 2, &base32_crockfordAlphabet));
+  TEST_ASSERT_EQUAL_UINT8(0x00 | 0x01 >> 2, decoded[0]);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeNAlphabet(decoded, &decodedLength,
+                                               BUFFER_SIZE, "CR======", 8,
+                                               &base32_crockfordAlphabet));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeNAlphabet(decoded, &decodedLength,
+                                               BUFFER_SIZE, "MZXW6YTB", 8,
+                                               &base32_hexAlphabet));
+
+  base32_alphabet custom;
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_alphabetInit(&custom,
+                                            "0123456789ABCDEFGHJKMNPQRSTVWXYZ",
+                                            '\0'));
+  TEST_ASSERT_EQUAL_STRING(base32_crockfordAlphabet.characters,
+                           custom.characters);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_alphabetInit(&custom,
+                                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567",
+                                            '='));
+  TEST_ASSERT_EQUAL_MEMORY(&base32_rfcAlphabet, &custom, sizeof(custom));
+  // Only ASCII letters are folded, independent of the locale
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_OK, base32_alphabetInit(
+                    &custom, "ABCDEFGHIJKLMNOPQRSTUVWXYZ2345\xC0i", '='));
+  TEST_ASSERT_EQUAL_UINT8(0, custom.reverse['a']);
+  TEST_ASSERT_EQUAL_UINT8(8, custom.reverse['I']);
+  TEST_ASSERT_EQUAL_UINT8(31, custom.reverse['i']);
+  TEST_ASSERT_EQUAL_UINT8(BASE32_INVALID, custom.reverse[0xE0]);
+  // A letter used as padding is not folded into a data value
+  TEST_ASSERT_EQUAL_INT(
+      BASEX_OK, base32_alphabetInit(
+                    &custom, "abcdefghijklmnopqrstuvwxyz234567", 'A'));
+  TEST_ASSERT_EQUAL_UINT8(BASE32_INVALID, custom.reverse['A']);
+  TEST_ASSERT_EQUAL_UINT8(12, custom.reverse['M']);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_encodeBytesAlphabet(encoded, BUFFER_SIZE,
+                                                   foobar, 1, &custom));
+  TEST_ASSERT_EQUAL_STRING("myAAAAAA", encoded);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeNAlphabet(decoded, &decodedLength,
+                                               BUFFER_SIZE, encoded, 8,
+                                               &custom));
+  TEST_ASSERT_EQUAL_size_t(1, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8('f', decoded[0]);
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_alphabetInit(&custom,
+                                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ23456A",
+                                            '='));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_alphabetInit(&custom,
+                                            "ABCDEFGHIJKLMNOPQRSTUVWXYZ23456=",
+                                            '='));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_alphabetInit(&custom, "ABC", '='));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, base32_alphabetInit(NULL, "A", '='));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_encodeBytesAlphabet(encoded, BUFFER_SIZE,
+                                                   foobar, 1, NULL));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_decodeNAlphabet(decoded, &decodedLength,
+                                               BUFFER_SIZE, "MY", 2, NULL));
+}
+
+void test_base32_layout(void)
+{
+  const uint8_t foobar[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+  const baseX_layout lines = {.lineLength = 8, .lineSeparator = "\n"};
+  const baseX_layout groups = {.groupLength = 4, .groupSeparator = " "};
+  char encoded[BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesLayout(
+                                      encoded, BUFFER_SIZE, foobar,
+                                      sizeof(foobar), &base32_rfcAlphabet,
+                                      &lines));
+  TEST_ASSERT_EQUAL_STRING("MZXW6YTB\nOI======", encoded);
+  TEST_ASSERT_EQUAL_size_t(12, base32_encodedLengthLayout(
+                                   sizeof(foobar), &base32_zAlphabet,
+                                   &groups));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesLayout(
+                                      encoded, 13, foobar, sizeof(foobar),
+                                      &base32_zAlphabet, &groups));
+  TEST_ASSERT_EQUAL_STRING("c3zs 6aub qe", encoded);
+
+  static uint8_t bytes[LAYOUT_TEST_SIZE];
+  static char plain[BASE32_ENCODED_LENGTH(LAYOUT_TEST_SIZE) + 1];
+  static char expected[2 * sizeof(plain)];
+  static char output[2 * sizeof(plain)];
+  srand(32);
+  for (size_t i = 0; i < LAYOUT_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (const baseX_layout *layout = testLayouts; layout->lineLength ||
+                                                  layout->groupLength;
+       layout++) {
+    for (size_t length = 0; length <= LAYOUT_TEST_SIZE;
+         length += 1 + length / 4) {
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytes(plain, sizeof(plain),
+                                                         bytes, length));
+      layoutReference(expected, plain, layout);
+      size_t expectedLength = strlen(expected);
+      TEST_ASSERT_EQUAL_size_t(expectedLength,
+                               base32_encodedLengthLayout(
+                                   length, &base32_rfcAlphabet, layout));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesLayout(
+                                          output, expectedLength + 1, bytes,
+                                          length, &base32_rfcAlphabet,
+                                          layout));
+      TEST_ASSERT_EQUAL_STRING(expected, output);
+      TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW, base32_encodeBytesLayout(
+                                                output, expectedLength, bytes,
+                                                length, &base32_rfcAlphabet,
+                                                layout));
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_encodeBytesLayout(encoded, BUFFER_SIZE, foobar,
+                                                 sizeof(foobar), NULL,
+                                                 &lines));
+}
+
+void test_base32_stream(void)
+{
+  char encoded[BUFFER_SIZE];
+  uint8_t decoded[BUFFER_SIZE];
+  size_t length = 0;
+  for (uint32_t i = 0; i < sizeof(base32_data) / sizeof(base32_data[0]); i++) {
+    base32_encodeContext encoder;
+    size_t pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeInit(&encoder));
+    for (uint32_t j = 0; j < base32_data[i].length; j += 2) {
+      uint32_t chunk =
+          base32_data[i].length - j < 2 ? base32_data[i].length - j : 2;
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK, base32_encodeUpdate(&encoder, encoded + pos,
+                                        BUFFER_SIZE - pos, &length,
+                                        &base32_data[i].byteStream[j], chunk));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_encodeFinal(&encoder, encoded + pos,
+                                             BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(strlen(base32_data[i].baseAsString), pos);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY(base32_data[i].baseAsString, encoded, pos);
+
+    base32_decodeContext decoder;
+    size_t encodedLength = pos;
+    pos = 0;
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeInit(&decoder));
+    for (size_t j = 0; j < encodedLength; j += 3) {
+      size_t chunk = encodedLength - j < 3 ? encodedLength - j : 3;
+      TEST_ASSERT_EQUAL_INT(
+          BASEX_OK,
+          base32_decodeUpdate(&decoder, decoded + pos, BUFFER_SIZE - pos,
+                              &length, base32_data[i].baseAsString + j, chunk));
+      pos += length;
+    }
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_decodeFinal(&decoder, decoded + pos,
+                                             BUFFER_SIZE - pos, &length));
+    pos += length;
+    TEST_ASSERT_EQUAL_size_t(base32_data[i].length, pos);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base32_data[i].byteStream, decoded, pos);
+  }
+
+  base32_decodeContext decoder;
+  base32_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeFinal(&decoder, decoded, BUFFER_SIZE,
+                                           &length)); // Empty input
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_decodeUpdate(&decoder, decoded, 4, &length,
+                                            "AAAAAAAA", 8));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeUpdate(&decoder, decoded,
+                                                      BUFFER_SIZE, &length,
+                                                      "MY==", 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, // Padding only at the end
+                        base32_decodeUpdate(&decoder, decoded, BUFFER_SIZE,
+                                            &length, "=A", 2));
+  base32_decodeInit(&decoder);
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR, // To much padding characters
+                        base32_decodeUpdate(&decoder, decoded, BUFFER_SIZE,
+                                            &length, "ABCDEFG==", 9));
 }
 
 void test_fail_base32_encodeBytes(void)
@@ -371,6 +1843,12 @@ void test_fail_base32_encodeBytes(void)
   TEST_ASSERT_EQUAL_INT(
       BASEX_OVERFLOW,
       base32_encodeBytes(encoded, 2, (const uint8_t *)"000", 3)); // Overflow
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_encodeBytes(encoded, BUFFER_SIZE,
+                                           (const uint8_t *)"000", 0xA0000000));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_encodeBytes(encoded, SIZE_MAX,
+                                           (const uint8_t *)"000", SIZE_MAX));
 }
 
 void test_base32_encodeBytes(void)
@@ -388,6 +1866,620 @@ void test_base32_encodeBytes(void)
   }
 }
 
+void test_base32_simdMatchesScalar(void)
+{
+  const base32_alphabet *alphabets[] = {&base32_rfcAlphabet, &base32_zAlphabet};
+  const uint32_t masks[] = {BASEX_CPU_BMI2, BASEX_CPU_AVX2,
+                            BASEX_CPU_AVX512VBMI, UINT32_MAX};
+  uint8_t bytes[SIMD_TEST_SIZE];
+  char scalar[BASE32_ENCODED_LENGTH(SIMD_TEST_SIZE) + 1];
+  char simd[BASE32_ENCODED_LENGTH(SIMD_TEST_SIZE) + 1];
+  uint8_t decoded[SIMD_TEST_SIZE];
+  size_t decodedLength = 0;
+  srand(32);
+  for (uint32_t i = 0; i < SIMD_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t m = 0; m < sizeof(masks) / sizeof(masks[0]); m++) {
+    for (uint32_t a = 0; a < sizeof(alphabets) / sizeof(alphabets[0]); a++) {
+      for (uint32_t length = 1; length <= SIMD_TEST_SIZE; length++) {
+        baseX_cpuSetMask(0);
+        TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesAlphabet(
+                                            scalar, sizeof(scalar), bytes,
+                                            length, alphabets[a]));
+        baseX_cpuSetMask(masks[m]);
+        TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytesAlphabet(
+                                            simd, sizeof(simd), bytes, length,
+                                            alphabets[a]));
+        TEST_ASSERT_EQUAL_STRING(scalar, simd);
+        // Lowercase letters of the RFC alphabet decode to the same bytes
+        if (&base32_rfcAlphabet == alphabets[a]) {
+          size_t n = strlen(simd);
+          for (size_t i = 0; i < n; i += 3) {
+            simd[i] = (char)tolower((unsigned char)simd[i]);
+          }
+        }
+        TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_decodeNAlphabet(
+                                            decoded, &decodedLength,
+                                            SIMD_TEST_SIZE, simd, strlen(simd),
+                                            alphabets[a]));
+        TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+      }
+    }
+
+    // Every invalid character has to be rejected at every group position
+    const char invalid[] = {'0', '1', '8', '@', '[', '{', '=', 0x10,
+                            (char)0xC1};
+    baseX_cpuSetMask(masks[m]);
+    base32_encodeBytes(scalar, sizeof(scalar), bytes, SIMD_TEST_SIZE);
+    for (uint32_t pos = 0; pos < BASE32_ENCODED_LENGTH(SIMD_TEST_SIZE) - 8;
+         pos += 7) {
+      for (uint32_t c = 0; c < sizeof(invalid); c++) {
+        char saved = scalar[pos];
+        scalar[pos] = invalid[c];
+        TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                              base32_decodeString(decoded, &decodedLength,
+                                                  SIMD_TEST_SIZE, scalar));
+        scalar[pos] = saved;
+      }
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+}
+
+void test_base32_lengths(void)
+{
+  uint8_t bytes[LENGTH_TEST_SIZE];
+  char encoded[BASE32_ENCODED_LENGTH(LENGTH_TEST_SIZE) + 1];
+  uint8_t decoded[BASE32_MAX_DECODED_LENGTH(sizeof(encoded))];
+  size_t decodedLength = 0;
+  memset(bytes, 0xA5, sizeof(bytes));
+  for (size_t length = 1; length <= LENGTH_TEST_SIZE; length++) {
+    size_t encodedLength = base32_encodedLength(length);
+    TEST_ASSERT_EQUAL_size_t(BASE32_ENCODED_LENGTH(length), encodedLength);
+    TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                          base32_encodeBytes(encoded, encodedLength, bytes,
+                                             length));
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytes(encoded,
+                                                       encodedLength + 1,
+                                                       bytes, length));
+    TEST_ASSERT_EQUAL_size_t(encodedLength, strlen(encoded));
+    size_t exactLength = base32_decodedLength(encoded, encodedLength);
+    TEST_ASSERT_EQUAL_size_t(length, exactLength);
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_decodeN(decoded, &decodedLength, exactLength,
+                                         encoded, encodedLength));
+    TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+    TEST_ASSERT_TRUE(base32_maxDecodedLength(encodedLength) >= length);
+    // Without padding the maximum length is exact
+    size_t dataLength = strcspn(encoded, "=");
+    TEST_ASSERT_EQUAL_size_t(length, base32_maxDecodedLength(dataLength));
+  }
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX, base32_encodedLength(SIZE_MAX));
+}
+
+void test_base32_batch(void)
+{
+  uint8_t bytes[BATCH_TEST_LONG];
+  baseX_batchItem items[BATCH_TEST_ITEMS];
+  baseX_batchItem encodedItems[BATCH_TEST_ITEMS];
+  size_t offsets[BATCH_TEST_ITEMS + 1];
+  size_t decodedOffsets[BATCH_TEST_ITEMS + 1];
+  char *arena = malloc(BATCH_TEST_ARENA);
+  char *expected = malloc(2 * BATCH_TEST_LONG + 1);
+  uint8_t *decoded = malloc(BATCH_TEST_ARENA);
+  size_t errorItem = 0;
+  TEST_ASSERT_NOT_NULL(arena);
+  TEST_ASSERT_NOT_NULL(expected);
+  TEST_ASSERT_NOT_NULL(decoded);
+  batchItems(items, bytes);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_encodeBatch(arena, 1000, offsets, items,
+                                           BATCH_TEST_ITEMS));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_encodeBatch(arena, BATCH_TEST_ARENA, offsets,
+                                           items, BATCH_TEST_ITEMS));
+  size_t decodeCount = 0;
+  for (uint32_t i = 0; i < BATCH_TEST_ITEMS; i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base32_encodeBytes(expected, 2 * BATCH_TEST_LONG + 1,
+                                             items[i].data, items[i].length));
+    TEST_ASSERT_EQUAL_size_t(strlen(expected), offsets[i + 1] - offsets[i]);
+    if (items[i].length) { // Empty items are not decodable
+      TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, arena + offsets[i],
+                                   offsets[i + 1] - offsets[i]);
+      encodedItems[decodeCount].data = arena + offsets[i];
+      encodedItems[decodeCount].length = offsets[i + 1] - offsets[i];
+      decodeCount++;
+    }
+  }
+
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeBatch(decoded, BATCH_TEST_ARENA,
+                                           decodedOffsets, encodedItems,
+                                           decodeCount, NULL));
+  for (uint32_t i = 0, j = 0; i < BATCH_TEST_ITEMS; i++) {
+    if (items[i].length) {
+      TEST_ASSERT_EQUAL_size_t(items[i].length,
+                               decodedOffsets[j + 1] - decodedOffsets[j]);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(items[i].data, decoded + decodedOffsets[j],
+                                    items[i].length);
+      j++;
+    }
+  }
+
+  // The failed item is reported
+  arena[offsets[7] + 1] = '1';
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeBatch(decoded, BATCH_TEST_ARENA,
+                                           decodedOffsets, encodedItems,
+                                           decodeCount, &errorItem));
+  TEST_ASSERT_EQUAL_size_t(6, errorItem); // Item 0 is empty and not decoded
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base32_decodeBatch(decoded, 10, decodedOffsets,
+                                           encodedItems, decodeCount,
+                                           &errorItem));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_decodeBatch(decoded, BATCH_TEST_ARENA, NULL,
+                                           encodedItems, decodeCount, NULL));
+
+  // Padding in a complete group and unpadded items like base32_decodeN()
+  baseX_batchItem padded[] = {{"MZXW6===", 8}, {"MY======MZXW6===", 16}};
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base32_decodeBatch(decoded, BATCH_TEST_ARENA,
+                                           decodedOffsets, padded, 2,
+                                           &errorItem));
+  TEST_ASSERT_EQUAL_size_t(1, errorItem);
+  baseX_batchItem unpadded[] = {{"MZXW6", 5}, {"MZXW6YTBOI", 10}};
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeBatch(decoded, BATCH_TEST_ARENA,
+                                           decodedOffsets, unpadded, 2,
+                                           NULL));
+  TEST_ASSERT_EQUAL_size_t(9, decodedOffsets[2]);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("foofoobar", decoded, 9);
+  free(arena);
+  free(expected);
+  free(decoded);
+}
+
+void test_fail_base64_decodeString(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t destLength;
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_decodeString(NULL, &destLength, BUFFER_SIZE,
+                                            "Zg==", BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_decodeString(decoded, NULL, BUFFER_SIZE, "Zg==",
+                                            BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            NULL, BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Zg==", 0x04)); // Unknown option
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "", BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Zg", BASE64_STANDARD)); // No pad
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Z===", BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Zg=A", BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Zg==", BASE64_NOPAD));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "Zm9vY", BASE64_NOPAD));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "+/+/", BASE64_URL));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base64_decodeString(decoded, &destLength, BUFFER_SIZE,
+                                            "-_-_", BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base64_decodeString(decoded, &destLength, 2, "Zm9v",
+                                            BASE64_STANDARD));
+}
+
+void test_base64_decodeString(void)
+{
+  uint8_t decoded[BUFFER_SIZE];
+  size_t decodedLength = 0;
+  for (uint32_t i = 0; i < sizeof(base64_data) / sizeof(base64_data[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK, base64_decodeString(
+                                        decoded, &decodedLength, BUFFER_SIZE,
+                                        base64_data[i].baseAsString,
+                                        BASE64_STANDARD));
+    TEST_ASSERT_EQUAL_size_t(base64_data[i].length, decodedLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(base64_data[i].byteStream, decoded,
+                                  base64_data[i].length);
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base64_decodeString(decoded, &decodedLength,
+                                            BUFFER_SIZE, "-_-_", BASE64_URL));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base64_data[4].byteStream, decoded, 3);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base64_decodeN(decoded, &decodedLength, BUFFER_SIZE,
+                                       "Zm8Zm9v", 3, BASE64_NOPAD));
+  TEST_ASSERT_EQUAL_size_t(2, decodedLength);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(base64_data[1].byteStream, decoded, 2);
+}
+
+void test_fail_base64_encodeBytes(void)
+{
+  char encoded[BUFFER_SIZE];
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_encodeBytes(NULL, BUFFER_SIZE,
+                                           (const uint8_t *)"000", 3,
+                                           BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_encodeBytes(encoded, BUFFER_SIZE, NULL, 3,
+                                           BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_encodeBytes(encoded, BUFFER_SIZE,
+                                           (const uint8_t *)"000", 3, 0x80));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base64_encodeBytes(encoded, 4, (const uint8_t *)"000",
+                                           3, BASE64_STANDARD));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        base64_encodeBytes(encoded, SIZE_MAX,
+                                           (const uint8_t *)"000", SIZE_MAX,
+                                           BASE64_STANDARD));
+}
+
+void test_base64_encodeBytes(void)
+{
+  char encoded[BUFFER_SIZE];
+  for (uint32_t i = 0; i < sizeof(base64_data) / sizeof(base64_data[0]); i++) {
+    TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                          base64_encodeBytes(encoded, BUFFER_SIZE,
+                                             base64_data[i].byteStream,
+                                             base64_data[i].length,
+                                             BASE64_STANDARD));
+    TEST_ASSERT_EQUAL_STRING(base64_data[i].baseAsString, encoded);
+  }
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base64_encodeBytes(
+                                      encoded, BUFFER_SIZE,
+                                      base64_data[4].byteStream, 3,
+                                      BASE64_URL));
+  TEST_ASSERT_EQUAL_STRING("-_-_", encoded);
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, base64_encodeBytes(
+                                      encoded, 4, base64_data[1].byteStream,
+                                      2, BASE64_URL | BASE64_NOPAD));
+  TEST_ASSERT_EQUAL_STRING("Zm8", encoded);
+}
+
+void test_base64_simdMatchesScalar(void)
+{
+  uint8_t bytes[SIMD_TEST_SIZE];
+  char scalar[2 * SIMD_TEST_SIZE];
+  char simd[2 * SIMD_TEST_SIZE];
+  uint8_t decoded[SIMD_TEST_SIZE];
+  size_t decodedLength = 0;
+  srand(64);
+  for (uint32_t i = 0; i < SIMD_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint8_t options = 0; options <= (BASE64_URL | BASE64_NOPAD);
+       options++) {
+    for (uint32_t length = 1; length <= SIMD_TEST_SIZE; length++) {
+      baseX_cpuSetMask(0);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base64_encodeBytes(scalar, sizeof(scalar),
+                                                         bytes, length,
+                                                         options));
+      baseX_cpuSetMask(UINT32_MAX);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base64_encodeBytes(simd, sizeof(simd),
+                                                         bytes, length,
+                                                         options));
+      TEST_ASSERT_EQUAL_STRING(scalar, simd);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base64_decodeString(decoded, &decodedLength,
+                                                SIMD_TEST_SIZE, simd, options));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+    }
+
+    // Every invalid character has to be rejected at every block position
+    const char invalid[] = {'=', '.', ':', '@', '[', '`', '{', (char)0xAB,
+                            (options & BASE64_URL) ? '+' : '-'};
+    size_t length = strlen(scalar);
+    for (uint32_t pos = 0; pos < length - 4; pos += 5) {
+      for (uint32_t c = 0; c < sizeof(invalid); c++) {
+        char saved = scalar[pos];
+        scalar[pos] = invalid[c];
+        TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                              base64_decodeString(decoded, &decodedLength,
+                                                  SIMD_TEST_SIZE, scalar,
+                                                  options));
+        scalar[pos] = saved;
+      }
+    }
+  }
+}
+
+void test_base64_lengths(void)
+{
+  uint8_t bytes[LENGTH_TEST_SIZE];
+  char encoded[BASE64_ENCODED_LENGTH(LENGTH_TEST_SIZE) + 1];
+  uint8_t decoded[BASE64_MAX_DECODED_LENGTH(sizeof(encoded))];
+  size_t decodedLength = 0;
+  memset(bytes, 0xA5, sizeof(bytes));
+  for (uint8_t options = 0; options <= (BASE64_URL | BASE64_NOPAD);
+       options++) {
+    for (size_t length = 1; length <= LENGTH_TEST_SIZE; length++) {
+      size_t encodedLength = base64_encodedLength(length, options);
+      TEST_ASSERT_EQUAL_size_t((options & BASE64_NOPAD)
+                                   ? BASE64_ENCODED_LENGTH_NOPAD(length)
+                                   : BASE64_ENCODED_LENGTH(length),
+                               encodedLength);
+      TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                            base64_encodeBytes(encoded, encodedLength, bytes,
+                                               length, options));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base64_encodeBytes(encoded, encodedLength + 1,
+                                               bytes, length, options));
+      TEST_ASSERT_EQUAL_size_t(encodedLength, strlen(encoded));
+      size_t exactLength = base64_decodedLength(encoded, encodedLength);
+      TEST_ASSERT_EQUAL_size_t(length, exactLength);
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base64_decodeN(decoded, &decodedLength,
+                                           exactLength, encoded,
+                                           encodedLength, options));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_TRUE(base64_maxDecodedLength(encodedLength) >= length);
+    }
+  }
+  TEST_ASSERT_EQUAL_size_t(SIZE_MAX,
+                           base64_encodedLength(SIZE_MAX, BASE64_STANDARD));
+}
+
+#define PARALLEL_TEST_SIZE (4 * 65536 + 7) ///< Input of the parallel tests
+
+void test_baseX_ignoreSpan(void)
+{
+  char text[IGNORE_TEST_SIZE];
+  memset(text, 'A', sizeof(text));
+  const char ignorable[] = {' ', '\t', '\n', '\v', '\f', '\r'};
+  const char kept[] = {'\0', '\x08', '\x0E', '!', '\x7F', (char)0x89,
+                       (char)0xA0};
+  for (uint32_t m = 0; m < sizeof(simdMasks) / sizeof(simdMasks[0]); m++) {
+    baseX_cpuSetMask(simdMasks[m]);
+    TEST_ASSERT_EQUAL_size_t(sizeof(text), baseX_ignoreSpan(text, sizeof(text),
+                                                            &baseX_whitespace));
+    for (size_t pos = 0; pos < sizeof(text); pos += 5) {
+      for (size_t c = 0; c < sizeof(kept); c++) {
+        text[pos] = kept[c];
+        TEST_ASSERT_EQUAL_size_t(sizeof(text),
+                                 baseX_ignoreSpan(text, sizeof(text),
+                                                  &baseX_whitespace));
+      }
+      for (size_t c = 0; c < sizeof(ignorable); c++) {
+        text[pos] = ignorable[c];
+        TEST_ASSERT_EQUAL_size_t(pos, baseX_ignoreSpan(text, sizeof(text),
+                                                       &baseX_whitespace));
+      }
+      text[pos] = 'A';
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  // A custom set resolves to the same tables as the prebuilt one
+  baseX_ignoreSet set;
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, baseX_ignoreInit(&set, " \t\n\v\f\r"));
+  TEST_ASSERT_EQUAL_MEMORY(&baseX_whitespace, &set, sizeof(set));
+  TEST_ASSERT_EQUAL_INT(BASEX_OK, baseX_ignoreInit(&set, ""));
+  TEST_ASSERT_EQUAL_size_t(3, baseX_ignoreSpan(" \n-", 3, &set));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, baseX_ignoreInit(&set, "\xC2\xA0"));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, baseX_ignoreInit(NULL, " "));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS, baseX_ignoreInit(&set, NULL));
+}
+
+#define IN_PLACE_TEST_SIZE (200)
+
+void test_baseX_decodeInPlace(void)
+{
+  uint8_t bytes[IN_PLACE_TEST_SIZE];
+  char buffer[BASE8_ENCODED_LENGTH(IN_PLACE_TEST_SIZE) + 1];
+  size_t decodedLength = 0;
+  srand(17);
+  for (uint32_t i = 0; i < IN_PLACE_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+  for (uint32_t m = 0; m < sizeof(simdMasks) / sizeof(simdMasks[0]); m++) {
+    baseX_cpuSetMask(simdMasks[m]);
+    for (size_t length = 1; length <= IN_PLACE_TEST_SIZE; length++) {
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base8_encodeBytes((uint8_t *)buffer, sizeof(buffer),
+                                              bytes, length));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base8_decodeInPlace(buffer, strlen(buffer),
+                                                &decodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, buffer, length);
+
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base16_encodeBytes(buffer, sizeof(buffer),
+                                                         bytes, length));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base16_decodeInPlace(buffer, strlen(buffer),
+                                                 &decodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, buffer, length);
+
+      TEST_ASSERT_EQUAL_INT(BASEX_OK, base32_encodeBytes(buffer, sizeof(buffer),
+                                                         bytes, length));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base32_decodeInPlace(buffer, strlen(buffer),
+                                                 &decodedLength));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, buffer, length);
+
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base64_encodeBytes(buffer, sizeof(buffer), bytes,
+                                               length, BASE64_NOPAD));
+      TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                            base64_decodeInPlace(buffer, strlen(buffer),
+                                                 &decodedLength, BASE64_NOPAD));
+      TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, buffer, length);
+    }
+  }
+  baseX_cpuSetMask(UINT32_MAX);
+
+  // Invalid input is reported, the buffer content is undefined afterwards
+  char invalid[] = "666F6G";
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        base16_decodeInPlace(invalid, 6, &decodedLength));
+  char padding[] = "MZXW6===";
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        base32_decodeInPlace(padding, 8, &decodedLength));
+  TEST_ASSERT_EQUAL_size_t(3, decodedLength);
+  TEST_ASSERT_EQUAL_CHAR_ARRAY("foo", padding, 3);
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base8_decodeInPlace(NULL, 8, &decodedLength));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base16_decodeInPlace(NULL, 2, &decodedLength));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base32_decodeInPlace(NULL, 8, &decodedLength));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        base64_decodeInPlace(NULL, 4, &decodedLength, 0));
+}
+
+void test_baseX_parallel(void)
+{
+  const baseX_base bases[] = {BASEX_BASE8, BASEX_BASE16, BASEX_BASE32};
+  const unsigned int threads[] = {1, 3, BASEX_PARALLEL_AUTO};
+  size_t encodedSize = BASE8_ENCODED_LENGTH(PARALLEL_TEST_SIZE) + 1;
+  uint8_t *bytes = malloc(PARALLEL_TEST_SIZE);
+  char *expected = malloc(encodedSize);
+  char *encoded = malloc(encodedSize);
+  uint8_t *decoded = malloc(PARALLEL_TEST_SIZE);
+  TEST_ASSERT_NOT_NULL(bytes);
+  TEST_ASSERT_NOT_NULL(expected);
+  TEST_ASSERT_NOT_NULL(encoded);
+  TEST_ASSERT_NOT_NULL(decoded);
+  srand(11);
+  for (size_t i = 0; i < PARALLEL_TEST_SIZE; i++) {
+    bytes[i] = (uint8_t)rand();
+  }
+
+  for (uint32_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+    // Tail lengths of all group sizes
+    for (size_t length = PARALLEL_TEST_SIZE - 4; length <= PARALLEL_TEST_SIZE;
+         length++) {
+      if (BASEX_BASE8 == bases[b]) {
+        base8_encodeBytes((uint8_t *)expected, encodedSize, bytes, length);
+      } else if (BASEX_BASE16 == bases[b]) {
+        base16_encodeBytes(expected, encodedSize, bytes, length);
+      } else {
+        base32_encodeBytes(expected, encodedSize, bytes, length);
+      }
+      size_t expectedLength = strlen(expected);
+      for (uint32_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        size_t decodedLength = 0;
+        TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                              baseX_parallelEncode(bases[b], encoded,
+                                                   encodedSize, bytes, length,
+                                                   threads[t]));
+        TEST_ASSERT_EQUAL_STRING(expected, encoded);
+        TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                              baseX_parallelDecode(bases[b], decoded,
+                                                   &decodedLength, length,
+                                                   encoded, expectedLength,
+                                                   threads[t]));
+        TEST_ASSERT_EQUAL_size_t(length, decodedLength);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, decoded, length);
+      }
+    }
+  }
+  free(bytes);
+  free(expected);
+  free(encoded);
+  free(decoded);
+}
+
+void test_fail_baseX_parallel(void)
+{
+  size_t encodedSize = BASE8_ENCODED_LENGTH(PARALLEL_TEST_SIZE) + 1;
+  uint8_t *bytes = calloc(PARALLEL_TEST_SIZE, 1);
+  char *encoded = malloc(encodedSize);
+  uint8_t *decoded = malloc(PARALLEL_TEST_SIZE);
+  size_t decodedLength = 0;
+  TEST_ASSERT_NOT_NULL(bytes);
+  TEST_ASSERT_NOT_NULL(encoded);
+  TEST_ASSERT_NOT_NULL(decoded);
+
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        baseX_parallelEncode(BASEX_BASE16, NULL, encodedSize,
+                                             bytes, PARALLEL_TEST_SIZE, 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        baseX_parallelEncode((baseX_base)7, encoded,
+                                             encodedSize, bytes,
+                                             PARALLEL_TEST_SIZE, 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        baseX_parallelEncode(BASEX_BASE16, encoded,
+                                             2 * PARALLEL_TEST_SIZE, bytes,
+                                             PARALLEL_TEST_SIZE, 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_ARGUMENTS,
+                        baseX_parallelDecode(BASEX_BASE16, decoded, NULL,
+                                             PARALLEL_TEST_SIZE, "00", 2, 4));
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        baseX_parallelDecode(BASEX_BASE16, decoded,
+                                             &decodedLength,
+                                             PARALLEL_TEST_SIZE, "", 0, 4));
+
+  // Invalid characters and padding are found in every part
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        baseX_parallelEncode(BASEX_BASE32, encoded,
+                                             encodedSize, bytes,
+                                             PARALLEL_TEST_SIZE, 4));
+  size_t length = strlen(encoded);
+  TEST_ASSERT_EQUAL_INT(BASEX_OVERFLOW,
+                        baseX_parallelDecode(BASEX_BASE32, decoded,
+                                             &decodedLength,
+                                             PARALLEL_TEST_SIZE - 8, encoded,
+                                             length, 4));
+  const size_t positions[] = {0, length / 2, length - 9};
+  for (uint32_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++) {
+    encoded[positions[i]] = '1';
+    TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                          baseX_parallelDecode(BASEX_BASE32, decoded,
+                                               &decodedLength,
+                                               PARALLEL_TEST_SIZE, encoded,
+                                               length, 4));
+    encoded[positions[i]] = '=';
+    TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                          baseX_parallelDecode(BASEX_BASE32, decoded,
+                                               &decodedLength,
+                                               PARALLEL_TEST_SIZE, encoded,
+                                               length, 4));
+    encoded[positions[i]] = 'A';
+  }
+
+  // Wrong base8 check number after the parts
+  TEST_ASSERT_EQUAL_INT(BASEX_OK,
+                        baseX_parallelEncode(BASEX_BASE8, encoded,
+                                             encodedSize, bytes,
+                                             PARALLEL_TEST_SIZE, 4));
+  length = strlen(encoded);
+  encoded[length - 1] ^= 0x01;
+  TEST_ASSERT_EQUAL_INT(BASEX_SRCERROR,
+                        baseX_parallelDecode(BASEX_BASE8, decoded,
+                                             &decodedLength,
+                                             PARALLEL_TEST_SIZE, encoded,
+                                             length, 4));
+  free(bytes);
+  free(encoded);
+  free(decoded);
+}
+
 int main(void)
 {
   UNITY_BEGIN();
@@ -396,19 +2488,62 @@ int main(void)
   RUN_TEST(test_base8_encode);
   RUN_TEST(test_fail_base8_decodeNum);
   RUN_TEST(test_base8_decodeNum);
+  RUN_TEST(test_fail_base8_decodeString);
+  RUN_TEST(test_base8_decodeString);
   RUN_TEST(test_fail_base8_stringToNum);
   RUN_TEST(test_base8_stringToNum);
+  RUN_TEST(test_base8_stringToNumN);
+  RUN_TEST(test_base8_stream);
+  RUN_TEST(test_fail_base8_stream);
+  RUN_TEST(test_base8_lengths);
+  RUN_TEST(test_base8_simdMatchesScalar);
+  RUN_TEST(test_base8_validate);
 
   // Base 16 Tests
   RUN_TEST(test_fail_base16_decodeString);
   RUN_TEST(test_base16_decodeString);
+  RUN_TEST(test_base16_decodeN);
+  RUN_TEST(test_base16_decodeConstantTime);
+  RUN_TEST(test_base16_decodeIgnore);
+  RUN_TEST(test_base16_validate);
   RUN_TEST(test_fail_base16_encodeBytes);
   RUN_TEST(test_base16_encodeBytes);
+  RUN_TEST(test_base16_alphabet);
+  RUN_TEST(test_base16_layout);
+  RUN_TEST(test_base16_stream);
+  RUN_TEST(test_base16_simdMatchesScalar);
+  RUN_TEST(test_base16_lengths);
+  RUN_TEST(test_base16_batch);
+  RUN_TEST(test_fail_base16_batch);
 
   // Base 32 Tests
   RUN_TEST(test_fail_base32_decodeString);
   RUN_TEST(test_base32_decodeString);
+  RUN_TEST(test_base32_decodeN);
+  RUN_TEST(test_base32_decodeLowerCase);
+  RUN_TEST(test_base32_decodeConstantTime);
+  RUN_TEST(test_base32_decodeIgnore);
+  RUN_TEST(test_base32_validate);
+  RUN_TEST(test_base32_alphabets);
+  RUN_TEST(test_base32_layout);
+  RUN_TEST(test_base32_stream);
   RUN_TEST(test_fail_base32_encodeBytes);
   RUN_TEST(test_base32_encodeBytes);
+  RUN_TEST(test_base32_simdMatchesScalar);
+  RUN_TEST(test_base32_lengths);
+  RUN_TEST(test_base32_batch);
+
+  // Base 64 Tests
+  RUN_TEST(test_fail_base64_decodeString);
+  RUN_TEST(test_base64_decodeString);
+  RUN_TEST(test_fail_base64_encodeBytes);
+  RUN_TEST(test_base64_encodeBytes);
+  RUN_TEST(test_base64_simdMatchesScalar);
+  RUN_TEST(test_base64_lengths);
+
+  RUN_TEST(test_baseX_ignoreSpan);
+  RUN_TEST(test_baseX_decodeInPlace);
+  RUN_TEST(test_baseX_parallel);
+  RUN_TEST(test_fail_baseX_parallel);
   return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,599 @@
+/**
+ * @file basex.c
+ * @author Adrian STEINER (adi.steiner@hotmail.ch)
+ * @brief Command-line tool to en- and decode files with the baseX library
+ *
+ * Converts a file or stdin to stdout or a file with base8, base16 or base32.
+ * Input files are memory mapped and read sequentially, other inputs are read
+ * in large chunks. The chunks are converted with the incremental encoder or
+ * decoder into a page aligned output buffer, which is written with a single
+ * write() per chunk. Large dumps are therefore limited by the I/O and not by
+ * the conversion.
+ *
+ * @version 0.1
+ * @date 17-10-2026
+ *
+ * @copyright (C) 2026 Adrian STEINER
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https: //www.gnu.org/licenses/>.
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "base16_converter.h"
+#include "base32_converter.h"
+#include "base8_converter.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BASEX_TOOL_CHUNK (4u * 1024u * 1024u) ///< Input bytes per conversion
+#define BASEX_TOOL_ALIGNMENT (4096)           ///< Alignment of the buffers
+#define BASEX_TOOL_SLACK (64) ///< Output space for pending and final groups
+
+/**
+ * @brief State of the incremental converter of every base
+ *
+ */
+typedef union {
+  base8_encodeContext base8Encode;   ///< base8 encoder
+  base8_decodeContext base8Decode;   ///< base8 decoder
+  base16_encodeContext base16Encode; ///< base16 encoder
+  base16_decodeContext base16Decode; ///< base16 decoder
+  base32_encodeContext base32Encode; ///< base32 encoder
+  base32_decodeContext base32Decode; ///< base32 decoder
+} basex_context;
+
+/**
+ * @brief Initializes the context of a converter
+ *
+ */
+typedef baseX_returnType (*basex_init)(basex_context *ctx);
+
+/**
+ * @brief Converts the next chunk, see the *_encodeUpdate and *_decodeUpdate
+ * functions
+ *
+ */
+typedef baseX_returnType (*basex_update)(basex_context *ctx,
+                                         uint8_t *out,
+                                         size_t outSize,
+                                         size_t *outLength,
+                                         const uint8_t *src,
+                                         size_t srcLength);
+
+/**
+ * @brief Flushes the last group, see the *_encodeFinal and *_decodeFinal
+ * functions
+ *
+ */
+typedef baseX_returnType (*basex_final)(basex_context *ctx,
+                                        uint8_t *out,
+                                        size_t outSize,
+                                        size_t *outLength);
+
+/**
+ * @brief The incremental converter of one base and direction
+ *
+ */
+typedef struct {
+  const char *codec;   ///< Name of the base
+  int decode;          ///< 1 for the decoder, 0 for the encoder
+  basex_init init;     ///< Initializes the context
+  basex_update update; ///< Converts a chunk
+  basex_final final;   ///< Flushes the last group
+} basex_converter;
+
+/**
+ * @brief Input and output of a conversion
+ *
+ */
+typedef struct {
+  int in;                  ///< Input file descriptor
+  int out;                 ///< Output file descriptor
+  const uint8_t *mapped;   ///< Memory mapped input, or NULL
+  size_t mappedLength;     ///< Length of mapped
+  uint8_t *inBuffer;       ///< Input buffer if the input is not mapped
+  uint8_t *outBuffer;      ///< Page aligned output buffer
+  size_t outSize;          ///< Size of outBuffer
+  unsigned long long read; ///< Number of input bytes
+  unsigned long long written; ///< Number of output bytes
+} basex_io;
+
+static baseX_returnType basex_base8EncodeInit(basex_context *ctx)
+{
+  return base8_encodeInit(&ctx->base8Encode);
+}
+
+static baseX_returnType basex_base8EncodeUpdate(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength,
+                                                const uint8_t *src,
+                                                size_t srcLength)
+{
+  return base8_encodeUpdate(&ctx->base8Encode, out, outSize, outLength, src,
+                            srcLength);
+}
+
+static baseX_returnType basex_base8EncodeFinal(basex_context *ctx,
+                                               uint8_t *out,
+                                               size_t outSize,
+                                               size_t *outLength)
+{
+  return base8_encodeFinal(&ctx->base8Encode, out, outSize, outLength);
+}
+
+static baseX_returnType basex_base8DecodeInit(basex_context *ctx)
+{
+  return base8_decodeInit(&ctx->base8Decode);
+}
+
+static baseX_returnType basex_base8DecodeUpdate(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength,
+                                                const uint8_t *src,
+                                                size_t srcLength)
+{
+  return base8_decodeUpdate(&ctx->base8Decode, out, outSize, outLength,
+                            (const char *)src, srcLength);
+}
+
+static baseX_returnType basex_base8DecodeFinal(basex_context *ctx,
+                                               uint8_t *out,
+                                               size_t outSize,
+                                               size_t *outLength)
+{
+  return base8_decodeFinal(&ctx->base8Decode, out, outSize, outLength);
+}
+
+static baseX_returnType basex_base16EncodeInit(basex_context *ctx)
+{
+  return base16_encodeInit(&ctx->base16Encode);
+}
+
+static baseX_returnType basex_base16EncodeUpdate(basex_context *ctx,
+                                                 uint8_t *out,
+                                                 size_t outSize,
+                                                 size_t *outLength,
+                                                 const uint8_t *src,
+                                                 size_t srcLength)
+{
+  return base16_encodeUpdate(&ctx->base16Encode, (char *)out, outSize,
+                             outLength, src, srcLength);
+}
+
+static baseX_returnType basex_base16EncodeFinal(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength)
+{
+  return base16_encodeFinal(&ctx->base16Encode, (char *)out, outSize,
+                            outLength);
+}
+
+static baseX_returnType basex_base16DecodeInit(basex_context *ctx)
+{
+  return base16_decodeInit(&ctx->base16Decode);
+}
+
+static baseX_returnType basex_base16DecodeUpdate(basex_context *ctx,
+                                                 uint8_t *out,
+                                                 size_t outSize,
+                                                 size_t *outLength,
+                                                 const uint8_t *src,
+                                                 size_t srcLength)
+{
+  return base16_decodeUpdate(&ctx->base16Decode, out, outSize, outLength,
+                             (const char *)src, srcLength);
+}
+
+static baseX_returnType basex_base16DecodeFinal(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength)
+{
+  return base16_decodeFinal(&ctx->base16Decode, out, outSize, outLength);
+}
+
+static baseX_returnType basex_base32EncodeInit(basex_context *ctx)
+{
+  return base32_encodeInit(&ctx->base32Encode);
+}
+
+static baseX_returnType basex_base32EncodeUpdate(basex_context *ctx,
+                                                 uint8_t *out,
+                                                 size_t outSize,
+                                                 size_t *outLength,
+                                                 const uint8_t *src,
+                                                 size_t srcLength)
+{
+  return base32_encodeUpdate(&ctx->base32Encode, (char *)out, outSize,
+                             outLength, src, srcLength);
+}
+
+static baseX_returnType basex_base32EncodeFinal(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength)
+{
+  return base32_encodeFinal(&ctx->base32Encode, (char *)out, outSize,
+                            outLength);
+}
+
+static baseX_returnType basex_base32DecodeInit(basex_context *ctx)
+{
+  return base32_decodeInit(&ctx->base32Decode);
+}
+
+static baseX_returnType basex_base32DecodeUpdate(basex_context *ctx,
+                                                 uint8_t *out,
+                                                 size_t outSize,
+                                                 size_t *outLength,
+                                                 const uint8_t *src,
+                                                 size_t srcLength)
+{
+  return base32_decodeUpdate(&ctx->base32Decode, out, outSize, outLength,
+                             (const char *)src, srcLength);
+}
+
+static baseX_returnType basex_base32DecodeFinal(basex_context *ctx,
+                                                uint8_t *out,
+                                                size_t outSize,
+                                                size_t *outLength)
+{
+  return base32_decodeFinal(&ctx->base32Decode, out, outSize, outLength);
+}
+
+static const basex_converter basex_converters[] = {
+    {"8", 0, basex_base8EncodeInit, basex_base8EncodeUpdate,
+     basex_base8EncodeFinal},
+    {"8", 1, basex_base8DecodeInit, basex_base8DecodeUpdate,
+     basex_base8DecodeFinal},
+    {"16", 0, basex_base16EncodeInit, basex_base16EncodeUpdate,
+     basex_base16EncodeFinal},
+    {"16", 1, basex_base16DecodeInit, basex_base16DecodeUpdate,
+     basex_base16DecodeFinal},
+    {"32", 0, basex_base32EncodeInit, basex_base32EncodeUpdate,
+     basex_base32EncodeFinal},
+    {"32", 1, basex_base32DecodeInit, basex_base32DecodeUpdate,
+     basex_base32DecodeFinal},
+};
+
+/**
+ * @brief Returns the current monotonic time in nanoseconds
+ *
+ * @return uint64_t Time in nanoseconds.
+ */
+static uint64_t basex_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Returns a description of the status code
+ *
+ */
+static const char *basex_statusText(baseX_returnType status)
+{
+  switch (status) {
+  case BASEX_OK:
+    return "success";
+  case BASEX_ARGUMENTS:
+    return "invalid arguments";
+  case BASEX_OVERFLOW:
+    return "output buffer too small";
+  case BASEX_SRCERROR:
+    return "invalid input";
+  default:
+    return "unexpected error";
+  }
+}
+
+/**
+ * @brief Writes the whole buffer, retrying after partial writes
+ *
+ * @param[in] fd Output file descriptor.
+ * @param[in] buffer Bytes to write.
+ * @param[in] length Number of bytes.
+ * @return int 0 on success, -1 on an error with errno set.
+ */
+static int basex_writeAll(int fd, const uint8_t *buffer, size_t length)
+{
+  while (length) {
+    ssize_t n = write(fd, buffer, length);
+    if (n < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return -1;
+    }
+    buffer += n;
+    length -= (size_t)n;
+  }
+  return 0;
+}
+
+/**
+ * @brief Returns the next input chunk
+ *
+ * A mapped input is returned in place, other inputs are read into the input
+ * buffer until it is full or the input ends.
+ *
+ * @param[in,out] io Input and output of the conversion.
+ * @param[out] chunk Start of the chunk.
+ * @param[out] length Length of the chunk, 0 at the end of the input.
+ * @return int 0 on success, -1 on a read error with errno set.
+ */
+static int basex_nextChunk(basex_io *io, const uint8_t **chunk, size_t *length)
+{
+  if (io->mapped) {
+    size_t offset = (size_t)io->read;
+    size_t remaining = io->mappedLength - offset;
+    *chunk = io->mapped + offset;
+    *length = remaining < BASEX_TOOL_CHUNK ? remaining : BASEX_TOOL_CHUNK;
+    io->read += *length;
+    return 0;
+  }
+  size_t filled = 0;
+  while (filled < BASEX_TOOL_CHUNK) {
+    ssize_t n = read(io->in, io->inBuffer + filled, BASEX_TOOL_CHUNK - filled);
+    if (n < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return -1;
+    }
+    if (0 == n) {
+      break;
+    }
+    filled += (size_t)n;
+  }
+  *chunk = io->inBuffer;
+  *length = filled;
+  io->read += filled;
+  return 0;
+}
+
+/**
+ * @brief Converts the whole input and writes the result
+ *
+ * A decoder ignores the line breaks at the end of the input. An encoder ends
+ * a non-empty output with a line break unless newline is 0.
+ *
+ * @param[in] c The converter.
+ * @param[in,out] io Input and output of the conversion.
+ * @param[in] newline Append a line break to the encoded output.
+ * @return int EXIT_SUCCESS or EXIT_FAILURE.
+ */
+static int basex_convert(const basex_converter *c, basex_io *io, int newline)
+{
+  basex_context ctx;
+  baseX_returnType status = c->init(&ctx);
+  int lineBreak = 0; // Line breaks seen at the end of the previous chunk
+  unsigned long long converted = 0;
+
+  for (;;) {
+    const uint8_t *chunk = NULL;
+    size_t length = 0;
+    if (basex_nextChunk(io, &chunk, &length)) {
+      fprintf(stderr, "basex: read error: %s\n", strerror(errno));
+      return EXIT_FAILURE;
+    }
+    if (0 == length) {
+      break;
+    }
+    if (c->decode) {
+      size_t data = length;
+      while (data && ('\n' == chunk[data - 1] || '\r' == chunk[data - 1])) {
+        data--;
+      }
+      if (lineBreak && data) {
+        status = BASEX_SRCERROR; // Characters after a line break
+        break;
+      }
+      lineBreak = data != length;
+      length = data;
+    }
+    size_t outLength = 0;
+    status = c->update(&ctx, io->outBuffer, io->outSize, &outLength, chunk,
+                       length);
+    if (BASEX_OK != status) {
+      break;
+    }
+    converted += length;
+    if (basex_writeAll(io->out, io->outBuffer, outLength)) {
+      fprintf(stderr, "basex: write error: %s\n", strerror(errno));
+      return EXIT_FAILURE;
+    }
+    io->written += outLength;
+  }
+
+  // An empty input converts to an empty output
+  if (BASEX_OK == status && converted) {
+    size_t outLength = 0;
+    status = c->final(&ctx, io->outBuffer, io->outSize, &outLength);
+    if (BASEX_OK == status && newline && !c->decode) {
+      io->outBuffer[outLength++] = '\n';
+    }
+    if (BASEX_OK == status) {
+      if (basex_writeAll(io->out, io->outBuffer, outLength)) {
+        fprintf(stderr, "basex: write error: %s\n", strerror(errno));
+        return EXIT_FAILURE;
+      }
+      io->written += outLength;
+    }
+  }
+  if (BASEX_OK != status) {
+    fprintf(stderr, "basex: base%s %s failed: %s\n", c->codec,
+            c->decode ? "decode" : "encode", basex_statusText(status));
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Opens the input and maps it if it is a regular file
+ *
+ * @param[in,out] io Input and output of the conversion.
+ * @param[in] path Input file, NULL or "-" for stdin.
+ * @return int 0 on success, -1 on an error with errno set.
+ */
+static int basex_openInput(basex_io *io, const char *path)
+{
+  io->in = STDIN_FILENO;
+  if (path && strcmp(path, "-")) {
+    io->in = open(path, O_RDONLY);
+    if (io->in < 0) {
+      return -1;
+    }
+  }
+  struct stat st;
+  if (0 == fstat(io->in, &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void *mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE,
+                        io->in, 0);
+    if (MAP_FAILED != mapped) {
+      posix_madvise(mapped, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+      io->mapped = mapped;
+      io->mappedLength = (size_t)st.st_size;
+      return 0;
+    }
+  }
+  // Pipes, terminals and files which cannot be mapped are read
+  if (posix_memalign((void **)&io->inBuffer, BASEX_TOOL_ALIGNMENT,
+                     BASEX_TOOL_CHUNK)) {
+    errno = ENOMEM;
+    return -1;
+  }
+  return 0;
+}
+
+static void basex_usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [options] [FILE]\n"
+          "Encodes FILE or stdin (FILE is - or missing) to stdout.\n"
+          "  -b BASE  Base 8, 16 or 32 (default 32)\n"
+          "  -d       Decode instead of encode\n"
+          "  -n       Do not end the encoded output with a line break\n"
+          "  -o FILE  Write to FILE instead of stdout\n"
+          "  -v       Report the throughput to stderr\n",
+          name);
+}
+
+int main(int argc, char **argv)
+{
+  const char *base = "32";
+  const char *output = NULL;
+  int decode = 0;
+  int newline = 1;
+  int verbose = 0;
+  int opt;
+  while (-1 != (opt = getopt(argc, argv, "b:dno:v"))) {
+    switch (opt) {
+    case 'b':
+      base = optarg;
+      break;
+    case 'd':
+      decode = 1;
+      break;
+    case 'n':
+      newline = 0;
+      break;
+    case 'o':
+      output = optarg;
+      break;
+    case 'v':
+      verbose = 1;
+      break;
+    default:
+      basex_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (argc - optind > 1) {
+    basex_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  const basex_converter *c = NULL;
+  for (size_t i = 0; i < sizeof(basex_converters) / sizeof(basex_converters[0]);
+       i++) {
+    if (0 == strcmp(base, basex_converters[i].codec) &&
+        decode == basex_converters[i].decode) {
+      c = &basex_converters[i];
+    }
+  }
+  if (!c) {
+    basex_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  basex_io io = {0};
+  const char *input = optind < argc ? argv[optind] : NULL;
+  if (basex_openInput(&io, input)) {
+    fprintf(stderr, "basex: %s: %s\n", input, strerror(errno));
+    return EXIT_FAILURE;
+  }
+  io.out = STDOUT_FILENO;
+  if (output && strcmp(output, "-")) {
+    io.out = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (io.out < 0) {
+      fprintf(stderr, "basex: %s: %s\n", output, strerror(errno));
+      return EXIT_FAILURE;
+    }
+  }
+  // Base8 needs the most space with 8 characters per 3 bytes
+  io.outSize = BASEX_TOOL_CHUNK / 3 * 8 + BASEX_TOOL_SLACK;
+  if (posix_memalign((void **)&io.outBuffer, BASEX_TOOL_ALIGNMENT,
+                     io.outSize)) {
+    fprintf(stderr, "basex: out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  uint64_t start = basex_now();
+  int ret = basex_convert(c, &io, newline);
+  uint64_t ns = basex_now() - start;
+  if (EXIT_SUCCESS == ret && io.out != STDOUT_FILENO && close(io.out)) {
+    fprintf(stderr, "basex: %s: %s\n", output, strerror(errno));
+    ret = EXIT_FAILURE;
+  }
+  if (verbose) {
+    // The throughput refers to the raw bytes like the benchmark
+    unsigned long long raw = decode ? io.written : io.read;
+    double seconds = (double)ns / 1e9;
+    fprintf(stderr,
+            "basex: base%s %s: %llu bytes in, %llu bytes out, %.3f s, "
+            "%.1f MiB/s\n",
+            c->codec, decode ? "decode" : "encode", io.read, io.written,
+            seconds,
+            seconds > 0 ? (double)raw / (1024.0 * 1024.0) / seconds : 0.0);
+  }
+
+  if (io.mapped) {
+    munmap((void *)io.mapped, io.mappedLength);
+  }
+  free(io.inBuffer);
+  free(io.outBuffer);
+  return ret;
+}